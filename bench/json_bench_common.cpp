@@ -0,0 +1,35 @@
+// C++ Standard Library
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Benchmark Support
+#include "bench/json_bench_common.h"
+
+namespace
+{
+
+std::atomic<std::size_t> n_allocations{0};
+
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+  n_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* const ptr = std::malloc((size > 0) ? size : 1); ptr != nullptr)
+  {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t size) noexcept { std::free(ptr); }
+
+namespace bench
+{
+
+std::size_t allocation_count() { return n_allocations.load(std::memory_order_relaxed); }
+
+}  // namespace bench
@@ -0,0 +1,275 @@
+#ifndef BOOST_ARCHIVE_JSON_BENCH_COMMON_H
+#define BOOST_ARCHIVE_JSON_BENCH_COMMON_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Boost
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/export.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/unique_ptr.hpp>
+
+namespace bench
+{
+
+/**
+ * @brief Returns the number of calls to global <code>operator new</code> made so far by this process
+ */
+std::size_t allocation_count();
+
+/**
+ * @brief Discards all output, counting the number of characters written
+ */
+struct counting_sink
+{
+  std::size_t size = 0;
+
+  inline void write(const char* data, const std::size_t size) { this->size += size; }
+};
+
+/**
+ * @brief Reports \p bytes processed and \p allocations made over all iterations of a benchmark
+ */
+inline void set_counters(benchmark::State& state, const std::size_t bytes, const std::size_t allocations)
+{
+  state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+  state.counters["allocs_per_op"] =
+    benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+struct Scalars
+{
+  bool b = true;
+  int i = -111;
+  std::int64_t i64 = -1234567890123LL;
+  std::uint64_t u64 = 18446744073709551615ULL;
+  float f = 0.1f;
+  double d = 0.25;
+  std::string s = "value";
+
+  template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+  {
+    ar& BOOST_SERIALIZATION_NVP(b);
+    ar& BOOST_SERIALIZATION_NVP(i);
+    ar& BOOST_SERIALIZATION_NVP(i64);
+    ar& BOOST_SERIALIZATION_NVP(u64);
+    ar& BOOST_SERIALIZATION_NVP(f);
+    ar& BOOST_SERIALIZATION_NVP(d);
+    ar& BOOST_SERIALIZATION_NVP(s);
+  }
+};
+
+struct TestStruct
+{
+  int m = 111;
+  double d = 0.25;
+  std::string s = "value";
+
+  template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+  {
+    ar& BOOST_SERIALIZATION_NVP(m);
+    ar& BOOST_SERIALIZATION_NVP(d);
+    ar& BOOST_SERIALIZATION_NVP(s);
+  }
+};
+
+/**
+ * @brief Struct with more members than json_object searches linearly
+ */
+struct WideStruct
+{
+  int i0 = 0, i1 = 1, i2 = 2, i3 = 3, i4 = 4, i5 = 5, i6 = 6, i7 = 7;
+  double d0 = 0.5, d1 = 1.5, d2 = 2.5, d3 = 3.5, d4 = 4.5, d5 = 5.5, d6 = 6.5, d7 = 7.5;
+  std::uint64_t u0 = 10, u1 = 11, u2 = 12, u3 = 13, u4 = 14, u5 = 15, u6 = 16, u7 = 17;
+  std::string s0 = "s0", s1 = "s1", s2 = "s2", s3 = "s3";
+
+  template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+  {
+    ar& BOOST_SERIALIZATION_NVP(i0);
+    ar& BOOST_SERIALIZATION_NVP(i1);
+    ar& BOOST_SERIALIZATION_NVP(i2);
+    ar& BOOST_SERIALIZATION_NVP(i3);
+    ar& BOOST_SERIALIZATION_NVP(i4);
+    ar& BOOST_SERIALIZATION_NVP(i5);
+    ar& BOOST_SERIALIZATION_NVP(i6);
+    ar& BOOST_SERIALIZATION_NVP(i7);
+    ar& BOOST_SERIALIZATION_NVP(d0);
+    ar& BOOST_SERIALIZATION_NVP(d1);
+    ar& BOOST_SERIALIZATION_NVP(d2);
+    ar& BOOST_SERIALIZATION_NVP(d3);
+    ar& BOOST_SERIALIZATION_NVP(d4);
+    ar& BOOST_SERIALIZATION_NVP(d5);
+    ar& BOOST_SERIALIZATION_NVP(d6);
+    ar& BOOST_SERIALIZATION_NVP(d7);
+    ar& BOOST_SERIALIZATION_NVP(u0);
+    ar& BOOST_SERIALIZATION_NVP(u1);
+    ar& BOOST_SERIALIZATION_NVP(u2);
+    ar& BOOST_SERIALIZATION_NVP(u3);
+    ar& BOOST_SERIALIZATION_NVP(u4);
+    ar& BOOST_SERIALIZATION_NVP(u5);
+    ar& BOOST_SERIALIZATION_NVP(u6);
+    ar& BOOST_SERIALIZATION_NVP(u7);
+    ar& BOOST_SERIALIZATION_NVP(s0);
+    ar& BOOST_SERIALIZATION_NVP(s1);
+    ar& BOOST_SERIALIZATION_NVP(s2);
+    ar& BOOST_SERIALIZATION_NVP(s3);
+  }
+};
+
+/**
+ * @brief Struct nested \p Depth levels deep
+ */
+template <std::size_t Depth> struct DeepStruct
+{
+  DeepStruct<Depth - 1> child;
+  int value = static_cast<int>(Depth);
+
+  template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+  {
+    ar& BOOST_SERIALIZATION_NVP(child);
+    ar& BOOST_SERIALIZATION_NVP(value);
+  }
+};
+
+template <> struct DeepStruct<0>
+{
+  int value = 0;
+
+  template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+  {
+    ar& BOOST_SERIALIZATION_NVP(value);
+  }
+};
+
+struct Shape
+{
+  double x = 1.0;
+  double y = 2.0;
+
+  virtual ~Shape() = default;
+
+  template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+  {
+    ar& BOOST_SERIALIZATION_NVP(x);
+    ar& BOOST_SERIALIZATION_NVP(y);
+  }
+};
+
+struct Circle : Shape
+{
+  double radius = 3.0;
+
+  template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+  {
+    ar& boost::serialization::make_nvp("shape", boost::serialization::base_object<Shape>(*this));
+    ar& BOOST_SERIALIZATION_NVP(radius);
+  }
+};
+
+struct Rectangle : Shape
+{
+  double width = 4.0;
+  double height = 5.0;
+
+  template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+  {
+    ar& boost::serialization::make_nvp("shape", boost::serialization::base_object<Shape>(*this));
+    ar& BOOST_SERIALIZATION_NVP(width);
+    ar& BOOST_SERIALIZATION_NVP(height);
+  }
+};
+
+using Shapes = std::vector<std::unique_ptr<Shape>>;
+
+inline std::vector<double> make_doubles(const std::size_t size)
+{
+  std::vector<double> value(size);
+  for (std::size_t i = 0; i < value.size(); ++i)
+  {
+    value[i] = 0.5 * static_cast<double>(i) + 1.0 / static_cast<double>(i + 3);
+  }
+  return value;
+}
+
+inline std::vector<float> make_floats(const std::size_t size)
+{
+  std::vector<float> value(size);
+  for (std::size_t i = 0; i < value.size(); ++i)
+  {
+    value[i] = 0.5f * static_cast<float>(i) + 1.0f / static_cast<float>(i + 3);
+  }
+  return value;
+}
+
+/**
+ * @brief Mask with an irregular pattern of set bits
+ */
+inline std::vector<bool> make_bits(const std::size_t size)
+{
+  std::vector<bool> value(size);
+  for (std::size_t i = 0; i < value.size(); ++i)
+  {
+    value[i] = (i * 2654435761U) & 0x100;
+  }
+  return value;
+}
+
+/**
+ * @brief Map from short, distinct names to numbers, as for a table of named parameters
+ */
+inline std::map<std::string, double> make_string_map(const std::size_t size)
+{
+  std::map<std::string, double> value;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    value.emplace("parameter_" + std::to_string(i), 0.25 * static_cast<double>(i));
+  }
+  return value;
+}
+
+/**
+ * @brief Strings with quotes, backslashes, control characters and multi-byte UTF-8 sequences to escape
+ */
+inline std::vector<std::string> make_escaped_strings(const std::size_t size)
+{
+  std::vector<std::string> value(size);
+  for (std::size_t i = 0; i < value.size(); ++i)
+  {
+    value[i] = "line " + std::to_string(i) + ": \"quoted\" C:\\path\\to\\file\tcolumn\r\n\x01\x1f caf\xc3\xa9";
+  }
+  return value;
+}
+
+inline Shapes make_shapes(const std::size_t size)
+{
+  Shapes value;
+  value.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    if (i % 2 == 0)
+    {
+      value.emplace_back(new Circle);
+    }
+    else
+    {
+      value.emplace_back(new Rectangle);
+    }
+  }
+  return value;
+}
+
+}  // namespace bench
+
+BOOST_CLASS_EXPORT_KEY(bench::Circle)
+BOOST_CLASS_EXPORT_KEY(bench::Rectangle)
+
+#endif  // BOOST_ARCHIVE_JSON_BENCH_COMMON_H
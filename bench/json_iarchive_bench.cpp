@@ -0,0 +1,296 @@
+// C++ Standard Library
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Boost Archive JSON
+#include <boost/archive/json_iarchive.h>
+#include <boost/archive/json_oarchive.h>
+#include <boost/archive/json_stream_iarchive.h>
+
+// Benchmark Support
+#include "bench/json_bench_common.h"
+
+BOOST_CLASS_EXPORT_IMPLEMENT(bench::Circle)
+BOOST_CLASS_EXPORT_IMPLEMENT(bench::Rectangle)
+
+namespace
+{
+
+struct string_sink
+{
+  std::string data;
+
+  inline void write(const char* data, const std::size_t size) { this->data.append(data, size); }
+};
+
+template <typename ArchiveT> ArchiveT make_archive(const std::string& data, const unsigned int flags)
+{
+  if constexpr (std::is_same<ArchiveT, boost::archive::json_iarchive>::value)
+  {
+    return ArchiveT{data.data(), data.size(), std::pmr::get_default_resource(), flags};
+  }
+  else
+  {
+    return ArchiveT{data.data(), data.size()};
+  }
+}
+
+/**
+ * @brief Loads \p ValueT from the serialization of \p value (saved with \p save_flags), read from memory
+ */
+template <typename ArchiveT, typename ValueT>
+void load_benchmark(
+  benchmark::State& state,
+  const ValueT& value,
+  const unsigned int save_flags = 0,
+  const unsigned int load_flags = 0)
+{
+  string_sink sink;
+  {
+    boost::archive::json_oarchive ar{sink, false, std::pmr::get_default_resource(), save_flags};
+    ar << boost::serialization::make_nvp("value", value);
+  }
+
+  std::size_t bytes_read = 0;
+  const std::size_t allocations_before = bench::allocation_count();
+  for (auto _ : state)
+  {
+    ValueT loaded;
+    {
+      auto ar = make_archive<ArchiveT>(sink.data, load_flags);
+      ar >> boost::serialization::make_nvp("value", loaded);
+    }
+    bytes_read += sink.data.size();
+    benchmark::DoNotOptimize(loaded);
+  }
+  bench::set_counters(state, bytes_read, bench::allocation_count() - allocations_before);
+}
+
+/**
+ * @brief Loads \p ValueT from the serialization of \p value, read from a stream by a new archive for every iteration
+ *
+ *        Each archive borrows \p buffers, if given.
+ */
+template <typename ArchiveT, typename ValueT>
+void load_stream_benchmark(
+  benchmark::State& state,
+  const ValueT& value,
+  boost::archive::json_archive_buffers* const buffers = nullptr)
+{
+  string_sink sink;
+  {
+    boost::archive::json_oarchive ar{sink};
+    ar << boost::serialization::make_nvp("value", value);
+  }
+
+  std::istringstream is;
+  std::size_t bytes_read = 0;
+  const std::size_t allocations_before = bench::allocation_count();
+  for (auto _ : state)
+  {
+    ValueT loaded;
+    is.str(sink.data);
+    {
+      std::optional<ArchiveT> ar;
+      if (buffers == nullptr)
+      {
+        ar.emplace(is);
+      }
+      else
+      {
+        ar.emplace(is, *buffers);
+      }
+      (*ar) >> boost::serialization::make_nvp("value", loaded);
+    }
+    bytes_read += sink.data.size();
+    benchmark::DoNotOptimize(loaded);
+  }
+  bench::set_counters(state, bytes_read, bench::allocation_count() - allocations_before);
+}
+
+/**
+ * @brief Loads only the header saved ahead of a body of \p body_size wide structs
+ */
+template <typename ArchiveT>
+void load_header_benchmark(benchmark::State& state, const std::size_t body_size, const unsigned int load_flags = 0)
+{
+  const bench::TestStruct header;
+  const std::vector<bench::WideStruct> body(body_size);
+  string_sink sink;
+  {
+    boost::archive::json_oarchive ar{sink};
+    ar << boost::serialization::make_nvp("header", header);
+    ar << boost::serialization::make_nvp("body", body);
+  }
+
+  std::size_t bytes_read = 0;
+  const std::size_t allocations_before = bench::allocation_count();
+  for (auto _ : state)
+  {
+    bench::TestStruct loaded;
+    {
+      auto ar = make_archive<ArchiveT>(sink.data, load_flags);
+      ar >> boost::serialization::make_nvp("header", loaded);
+    }
+    bytes_read += sink.data.size();
+    benchmark::DoNotOptimize(loaded);
+  }
+  bench::set_counters(state, bytes_read, bench::allocation_count() - allocations_before);
+}
+
+template <typename ArchiveT> void BM_LoadScalars(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::Scalars{});
+}
+
+template <typename ArchiveT> void BM_LoadDeepStruct(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::DeepStruct<32>{});
+}
+
+template <typename ArchiveT> void BM_LoadWideStructStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, std::vector<bench::WideStruct>(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_LoadDoubleStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::make_doubles(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_LoadBoolStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::make_bits(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_LoadStringStdMap(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::make_string_map(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_LoadFloatStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::make_floats(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_LoadFloatStdVectorBinary(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::make_floats(state.range(0)), boost::archive::json_binary_arrays);
+}
+
+template <typename ArchiveT> void BM_LoadStructStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, std::vector<bench::TestStruct>(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_LoadEscapedStringStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::make_escaped_strings(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_LoadPolymorphicPointerStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::make_shapes(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_LoadIndexedWideStructStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(
+    state, std::vector<bench::WideStruct>(state.range(0)), 0, boost::archive::json_indexed_parse);
+}
+
+template <typename ArchiveT> void BM_LoadIndexedDoubleStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::make_doubles(state.range(0)), 0, boost::archive::json_indexed_parse);
+}
+
+template <typename ArchiveT> void BM_LoadIndexedStructStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(
+    state, std::vector<bench::TestStruct>(state.range(0)), 0, boost::archive::json_indexed_parse);
+}
+
+template <typename ArchiveT> void BM_LoadIndexedEscapedStringStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(state, bench::make_escaped_strings(state.range(0)), 0, boost::archive::json_indexed_parse);
+}
+
+template <typename ArchiveT> void BM_LoadParallelStructStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(
+    state, std::vector<bench::TestStruct>(state.range(0)), 0, boost::archive::json_parallel_parse);
+}
+
+template <typename ArchiveT> void BM_LoadParallelWideStructStdVector(benchmark::State& state)
+{
+  load_benchmark<ArchiveT>(
+    state, std::vector<bench::WideStruct>(state.range(0)), 0, boost::archive::json_parallel_parse);
+}
+
+template <typename ArchiveT> void BM_LoadHeader(benchmark::State& state)
+{
+  load_header_benchmark<ArchiveT>(state, state.range(0));
+}
+
+template <typename ArchiveT> void BM_LoadLazyHeader(benchmark::State& state)
+{
+  load_header_benchmark<ArchiveT>(state, state.range(0), boost::archive::json_lazy_parse);
+}
+
+template <typename ArchiveT> void BM_LoadScalarsStream(benchmark::State& state)
+{
+  load_stream_benchmark<ArchiveT>(state, bench::Scalars{});
+}
+
+template <typename ArchiveT> void BM_LoadScalarsStreamWithBuffers(benchmark::State& state)
+{
+  boost::archive::json_archive_buffers buffers;
+  load_stream_benchmark<ArchiveT>(state, bench::Scalars{}, &buffers);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_LoadScalars, boost::archive::json_iarchive);
+BENCHMARK_TEMPLATE(BM_LoadScalars, boost::archive::json_stream_iarchive);
+BENCHMARK_TEMPLATE(BM_LoadDeepStruct, boost::archive::json_iarchive);
+BENCHMARK_TEMPLATE(BM_LoadDeepStruct, boost::archive::json_stream_iarchive);
+BENCHMARK_TEMPLATE(BM_LoadWideStructStdVector, boost::archive::json_iarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_LoadWideStructStdVector, boost::archive::json_stream_iarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_LoadDoubleStdVector, boost::archive::json_iarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadDoubleStdVector, boost::archive::json_stream_iarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadBoolStdVector, boost::archive::json_iarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadBoolStdVector, boost::archive::json_stream_iarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadStringStdMap, boost::archive::json_iarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LoadStringStdMap, boost::archive::json_stream_iarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LoadFloatStdVector, boost::archive::json_iarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadFloatStdVector, boost::archive::json_stream_iarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadFloatStdVectorBinary, boost::archive::json_iarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadFloatStdVectorBinary, boost::archive::json_stream_iarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadStructStdVector, boost::archive::json_iarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LoadStructStdVector, boost::archive::json_stream_iarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LoadEscapedStringStdVector, boost::archive::json_iarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LoadEscapedStringStdVector, boost::archive::json_stream_iarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LoadPolymorphicPointerStdVector, boost::archive::json_iarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_LoadPolymorphicPointerStdVector, boost::archive::json_stream_iarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_LoadIndexedWideStructStdVector, boost::archive::json_iarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_LoadIndexedDoubleStdVector, boost::archive::json_iarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_LoadIndexedStructStdVector, boost::archive::json_iarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LoadIndexedEscapedStringStdVector, boost::archive::json_iarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LoadParallelStructStdVector, boost::archive::json_iarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_LoadParallelWideStructStdVector, boost::archive::json_iarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_LoadHeader, boost::archive::json_iarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_LoadHeader, boost::archive::json_stream_iarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_LoadLazyHeader, boost::archive::json_iarchive)->Arg(1 << 12);
+
+BENCHMARK_TEMPLATE(BM_LoadScalarsStream, boost::archive::json_iarchive);
+BENCHMARK_TEMPLATE(BM_LoadScalarsStreamWithBuffers, boost::archive::json_iarchive);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,176 @@
+// C++ Standard Library
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// Boost Archive JSON
+#include <boost/archive/json_oarchive.h>
+#include <boost/archive/json_stream_oarchive.h>
+
+// Benchmark Support
+#include "bench/json_bench_common.h"
+
+BOOST_CLASS_EXPORT_IMPLEMENT(bench::Circle)
+BOOST_CLASS_EXPORT_IMPLEMENT(bench::Rectangle)
+
+namespace
+{
+
+template <typename ArchiveT> ArchiveT make_archive(bench::counting_sink& sink, const unsigned int flags)
+{
+  if constexpr (std::is_same<ArchiveT, boost::archive::json_oarchive>::value)
+  {
+    return ArchiveT{sink, false, std::pmr::get_default_resource(), flags};
+  }
+  else
+  {
+    return ArchiveT{sink, false, flags};
+  }
+}
+
+template <typename ArchiveT, typename ValueT>
+void save_benchmark(benchmark::State& state, const ValueT& value, const unsigned int flags = 0)
+{
+  std::size_t bytes_written = 0;
+  const std::size_t allocations_before = bench::allocation_count();
+  for (auto _ : state)
+  {
+    bench::counting_sink sink;
+    {
+      auto ar = make_archive<ArchiveT>(sink, flags);
+      ar << boost::serialization::make_nvp("value", value);
+    }
+    bytes_written += sink.size;
+    benchmark::DoNotOptimize(sink);
+  }
+  bench::set_counters(state, bytes_written, bench::allocation_count() - allocations_before);
+}
+
+/**
+ * @brief Saves \p value with a new archive for every iteration, each borrowing the same buffers
+ */
+template <typename ArchiveT, typename ValueT>
+void save_with_buffers_benchmark(benchmark::State& state, const ValueT& value)
+{
+  boost::archive::json_archive_buffers buffers;
+  std::size_t bytes_written = 0;
+  const std::size_t allocations_before = bench::allocation_count();
+  for (auto _ : state)
+  {
+    bench::counting_sink sink;
+    {
+      ArchiveT ar{sink, buffers};
+      ar << boost::serialization::make_nvp("value", value);
+    }
+    bytes_written += sink.size;
+    benchmark::DoNotOptimize(sink);
+  }
+  bench::set_counters(state, bytes_written, bench::allocation_count() - allocations_before);
+}
+
+template <typename ArchiveT> void BM_SaveScalars(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::Scalars{});
+}
+
+template <typename ArchiveT> void BM_SaveDeepStruct(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::DeepStruct<32>{});
+}
+
+template <typename ArchiveT> void BM_SaveWideStructStdVector(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, std::vector<bench::WideStruct>(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_SaveDoubleStdVector(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::make_doubles(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_SaveBoolStdVector(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::make_bits(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_SaveStringStdMap(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::make_string_map(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_SaveFloatStdVector(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::make_floats(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_SaveFloatStdVectorBinary(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::make_floats(state.range(0)), boost::archive::json_binary_arrays);
+}
+
+template <typename ArchiveT> void BM_SaveStructStdVector(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, std::vector<bench::TestStruct>(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_SaveParallelStructStdVector(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(
+    state, std::vector<bench::TestStruct>(state.range(0)), boost::archive::json_parallel_serialize);
+}
+
+template <typename ArchiveT> void BM_SaveParallelDoubleStdVector(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::make_doubles(state.range(0)), boost::archive::json_parallel_serialize);
+}
+
+template <typename ArchiveT> void BM_SaveEscapedStringStdVector(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::make_escaped_strings(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_SavePolymorphicPointerStdVector(benchmark::State& state)
+{
+  save_benchmark<ArchiveT>(state, bench::make_shapes(state.range(0)));
+}
+
+template <typename ArchiveT> void BM_SaveScalarsWithBuffers(benchmark::State& state)
+{
+  save_with_buffers_benchmark<ArchiveT>(state, bench::Scalars{});
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_SaveScalars, boost::archive::json_oarchive);
+BENCHMARK_TEMPLATE(BM_SaveScalars, boost::archive::json_stream_oarchive);
+BENCHMARK_TEMPLATE(BM_SaveDeepStruct, boost::archive::json_oarchive);
+BENCHMARK_TEMPLATE(BM_SaveDeepStruct, boost::archive::json_stream_oarchive);
+BENCHMARK_TEMPLATE(BM_SaveWideStructStdVector, boost::archive::json_oarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_SaveWideStructStdVector, boost::archive::json_stream_oarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_SaveDoubleStdVector, boost::archive::json_oarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SaveDoubleStdVector, boost::archive::json_stream_oarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SaveBoolStdVector, boost::archive::json_oarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SaveBoolStdVector, boost::archive::json_stream_oarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SaveStringStdMap, boost::archive::json_oarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SaveStringStdMap, boost::archive::json_stream_oarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SaveFloatStdVector, boost::archive::json_oarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SaveFloatStdVector, boost::archive::json_stream_oarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SaveFloatStdVectorBinary, boost::archive::json_oarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SaveFloatStdVectorBinary, boost::archive::json_stream_oarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SaveStructStdVector, boost::archive::json_oarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SaveStructStdVector, boost::archive::json_stream_oarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SaveParallelStructStdVector, boost::archive::json_oarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SaveParallelDoubleStdVector, boost::archive::json_oarchive)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SaveEscapedStringStdVector, boost::archive::json_oarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SaveEscapedStringStdVector, boost::archive::json_stream_oarchive)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_SavePolymorphicPointerStdVector, boost::archive::json_oarchive)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(BM_SavePolymorphicPointerStdVector, boost::archive::json_stream_oarchive)->Arg(1 << 12);
+
+BENCHMARK_TEMPLATE(BM_SaveScalarsWithBuffers, boost::archive::json_oarchive);
+
+BENCHMARK_MAIN();
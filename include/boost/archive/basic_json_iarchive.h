@@ -0,0 +1,485 @@
+#ifndef BOOST_ARCHIVE_BASIC_JSON_IARCHIVE_H
+#define BOOST_ARCHIVE_BASIC_JSON_IARCHIVE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Boost
+#include <boost/archive/detail/common_iarchive.hpp>
+
+// Boost Archive JSON
+#include <boost/archive/json_document.h>
+#include <boost/archive/json_typed_array.h>
+#include <boost/serialization/array.hpp>
+#include <boost/serialization/item_version_type.hpp>
+#include <boost/serialization/nvp.hpp>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Common load dispatch shared by all JSON input archives
+ *
+ *        \p JsonT is the input backend. It must provide:
+ *
+ *          - <code>ctx_find(tag)</code> / <code>ctx_end(tag)</code>, to enter/leave an existing keyed member of the active
+ *            object; <code>ctx_find</code> returns <code>false</code> if there is no such member
+ *          - <code>ctx_find_next(tag)</code>, like <code>ctx_find</code>, but only checking the next member of the
+ *            active object, for metadata which is always saved ahead of other members
+ *          - <code>get<T>()</code>, to read the active value as one of the \p json_native_types
+ *          - <code>array_size()</code>, returning the number of elements in the active array, if known up front
+ *          - <code>array_for_each(load_element)</code>, making each element of the active array active in turn
+ *          - <code>array_for_each_number<JsonNumberT>(store)</code>, passing each element of the active array to
+ *            \p store as a number
+ *          - <code>array_for_each_bool(store)</code>, passing each element of the active array to \p store as a
+ *            <code>bool</code>, for <code>std::vector<bool></code> and <code>std::bitset</code>
+ *          - <code>object_size()</code>, returning the number of members in the active object, if known up front
+ *          - <code>object_for_each(load_member)</code>, making each member of the active object active in turn, and
+ *            passing its name to \p load_member
+ *          - <code>is_object()</code>, which is <code>true</code> if the active value is an object
+ *          - <code>is_null()</code>, which is <code>true</code> if the active value is <code>null</code>
+ *
+ *        Arrays of numbers are loaded from either JSON arrays or base64-encoded binary data, as saved with the
+ *        \p json_binary_arrays flag.
+ */
+template <typename ArchiveT, typename JsonT> class basic_json_iarchive : public detail::common_iarchive<ArchiveT>
+{
+public:
+  inline void load_start(const char* tag)
+  {
+    if (!json_.ctx_find(tag))
+    {
+      throw std::runtime_error{"Missing JSON object member"};
+    }
+  }
+
+  inline void load_end(const char* tag) { json_.ctx_end(tag); }
+
+  template <typename T> void load_override(const boost::serialization::nvp<T>& kv)
+  {
+    // Unnamed values (e.g. objects behind pointers) are loaded from the active object, alongside their metadata
+    if (kv.name() == nullptr)
+    {
+      this->load(kv.value());
+      return;
+    }
+
+    load_member(kv.name(), kv.value(), true);
+  }
+
+  /**
+   * @brief Loads archive metadata from its reserved member; metadata which is missing keeps its default value
+   */
+  template <typename T>
+  std::enable_if_t<fusion::result_of::has_key<meta_type_conversions, T>::type::value> load_override(T& value)
+  {
+    // Metadata is saved ahead of all other members, so members which are left out are not looked for further
+    if (load_member(fusion::at_key<T>(meta_type_names), value, false, true))
+    {
+      return;
+    }
+
+    // References to classes and objects which were already saved are loaded as IDs, but saved as references
+    if constexpr (std::is_same<class_id_type, T>::value)
+    {
+      load_member(fusion::at_key<class_id_reference_type>(meta_type_names), value, false, true);
+    }
+    else if constexpr (std::is_same<object_id_type, T>::value)
+    {
+      load_member(fusion::at_key<object_reference_type>(meta_type_names), value, false, true);
+    }
+  }
+
+  template <typename T>
+  std::enable_if_t<!fusion::result_of::has_key<meta_type_conversions, T>::type::value> load_override(T& value)
+  {
+    detail::common_iarchive<ArchiveT>::load_override(value);
+  }
+
+  template <typename T> void load(T& value)
+  {
+    if constexpr (fusion::result_of::has_key<json_native_types, T>::type::value)
+    {
+      value = json_.template get<T>();
+    }
+    else if constexpr (fusion::result_of::has_key<json_conversions, T>::type::value)
+    {
+      value = narrow<T>(json_.template get<detail::json_type_t<T>>());
+    }
+    else if constexpr (std::is_same<class_name_type, T>::value)
+    {
+      const auto& class_name = json_.template get<std::string>();
+      if (class_name.size() >= BOOST_SERIALIZATION_MAX_KEY_SIZE)
+      {
+        throw std::runtime_error{"Class name is too long"};
+      }
+      std::memcpy(value.t, class_name.data(), class_name.size());
+      value.t[class_name.size()] = '\0';
+    }
+    else if constexpr (std::is_same<serialization::collection_size_type, T>::value)
+    {
+      // Collections without an array path load each element from another "item" member, which objects merge
+      static_assert(
+        !std::is_same<JsonT, json_document>::value,
+        "Collections loaded element by element can only be loaded with json_stream_iarchive or ndjson_iarchive");
+      value = static_cast<std::size_t>(json_.template get<std::uint64_t>());
+    }
+    else if constexpr (std::is_same<serialization::item_version_type, T>::value)
+    {
+      value = serialization::item_version_type{narrow<unsigned int>(json_.template get<std::uint64_t>())};
+    }
+    else if constexpr (fusion::result_of::has_key<meta_type_conversions, T>::type::value)
+    {
+      using load_type = typename fusion::result_of::value_at_key<meta_type_conversions, T>::type;
+      const load_type loaded = json_.template get<load_type>();
+      if constexpr (std::is_convertible<T&, class_id_type&>::value)
+      {
+        value = T{class_id_type{static_cast<int>(loaded)}};
+      }
+      else if constexpr (std::is_convertible<T&, object_id_type&>::value)
+      {
+        value = T{object_id_type{static_cast<std::size_t>(loaded)}};
+      }
+      else if constexpr (std::is_same<version_type, T>::value)
+      {
+        value = version_type{static_cast<unsigned int>(loaded)};
+      }
+      else
+      {
+        value = T{loaded};
+      }
+    }
+    else if constexpr (detail::is_number_array<T>::value)
+    {
+      if (json_.is_object())
+      {
+        load_binary_array(value);
+      }
+      else if constexpr (detail::is_fixed_size_array<T>::value)
+      {
+        using element_type = detail::element_type_t<T>;
+        auto witr = std::begin(value);
+        json_.template array_for_each_number<detail::json_type_t<element_type>>([&witr, &value](const auto loaded) {
+          if (witr == std::end(value))
+          {
+            throw std::runtime_error{"Too many elements for fixed-size array"};
+          }
+          *witr++ = narrow<element_type>(loaded);
+        });
+      }
+      else
+      {
+        using element_type = detail::element_type_t<T>;
+        value.clear();
+        value.reserve(json_.array_size());
+        json_.template array_for_each_number<detail::json_type_t<element_type>>(
+          [&value](const auto loaded) { value.push_back(narrow<element_type>(loaded)); });
+      }
+    }
+    else if constexpr (detail::is_fixed_size_array<T>::value)
+    {
+      auto witr = std::begin(value);
+
+      json_.array_for_each([this, &witr, &value] {
+        if (witr == std::end(value))
+        {
+          throw std::runtime_error{"Too many elements for fixed-size array"};
+        }
+        this->load(*witr++);
+      });
+    }
+    else if constexpr (detail::is_std_vector_bool<T>::value)
+    {
+      value.clear();
+      value.reserve(json_.array_size());
+      json_.array_for_each_bool([&value](const bool loaded) { value.push_back(loaded); });
+    }
+    else if constexpr (detail::is_std_bitset<T>::value)
+    {
+      std::size_t n = 0;
+      json_.array_for_each_bool([&n, &value](const bool loaded) {
+        if (n == value.size())
+        {
+          throw std::runtime_error{"Too many elements for fixed-size array"};
+        }
+        value.set(n++, loaded);
+      });
+    }
+    else if constexpr (detail::is_std_vector<T>::value)
+    {
+      value.clear();
+      value.reserve(json_.array_size());
+
+      json_.array_for_each([this, &value] {
+        value.emplace_back();
+        this->load(value.back());
+      });
+    }
+    else if constexpr (detail::is_std_sequence<T>::value)
+    {
+      value.clear();
+
+      json_.array_for_each([this, &value] {
+        value.emplace_back();
+        this->load(value.back());
+      });
+    }
+    else if constexpr (detail::is_std_forward_list<T>::value)
+    {
+      value.clear();
+
+      auto last = value.before_begin();
+      json_.array_for_each([this, &value, &last] {
+        last = value.emplace_after(last);
+        this->load(*last);
+      });
+    }
+    else if constexpr (detail::is_std_set<T>::value)
+    {
+      value.clear();
+      reserve(value, json_.array_size());
+
+      // Elements are saved in order, so each one is inserted at the end of an ordered set in constant time
+      json_.array_for_each([this, &value] {
+        typename T::key_type element{};
+        this->load(element);
+        value.insert(value.end(), std::move(element));
+      });
+    }
+    else if constexpr (detail::is_std_string_map<T>::value)
+    {
+      value.clear();
+      reserve(value, json_.object_size());
+
+      json_.object_for_each([this, &value](const std::string_view key) {
+        const auto itr =
+          value.emplace_hint(value.end(), std::piecewise_construct, std::forward_as_tuple(key), std::tuple<>{});
+        this->load(itr->second);
+      });
+    }
+    else if constexpr (detail::is_std_map<T>::value)
+    {
+      value.clear();
+      reserve(value, json_.array_size());
+
+      json_.array_for_each([this, &value] {
+        std::pair<typename T::key_type, typename T::mapped_type> entry{};
+        std::size_t n = 0;
+        json_.array_for_each([this, &entry, &n] {
+          if (n == 0)
+          {
+            this->load(entry.first);
+          }
+          else if (n == 1)
+          {
+            this->load(entry.second);
+          }
+          else
+          {
+            throw std::runtime_error{"Expected [key, value] pair"};
+          }
+          ++n;
+        });
+        if (n != 2)
+        {
+          throw std::runtime_error{"Expected [key, value] pair"};
+        }
+        value.insert(value.end(), std::move(entry));
+      });
+    }
+    else if constexpr (detail::is_std_optional<T>::value)
+    {
+      if (json_.is_null())
+      {
+        value.reset();
+      }
+      else
+      {
+        if (!value.has_value())
+        {
+          value.emplace();
+        }
+        this->load(*value);
+      }
+    }
+    else if constexpr (detail::is_std_variant<T>::value)
+    {
+      std::uint64_t which = 0;
+      load_member("which", which, true);
+      load_alternative(value, which);
+    }
+    else
+    {
+      detail::common_iarchive<ArchiveT>::load_override(value);
+    }
+  }
+
+private:
+  /**
+   * @brief Reserves room for \p size elements in \p value, if it is a container which can reserve room up front
+   */
+  template <typename T> static inline void reserve(T& value, const std::size_t size)
+  {
+    if constexpr (detail::has_reserve<T>::value)
+    {
+      value.reserve(size);
+    }
+  }
+
+  /**
+   * @brief Makes the alternative at index \p which of \p value active, and loads it from the <code>value</code>
+   *        member unless it is a <code>std::monostate</code>
+   */
+  template <typename T, std::size_t I = 0> void load_alternative(T& value, const std::uint64_t which)
+  {
+    if constexpr (I == std::variant_size<T>::value)
+    {
+      throw std::runtime_error{"Variant alternative index out of range"};
+    }
+    else if (which != I)
+    {
+      load_alternative<T, I + 1>(value, which);
+    }
+    else
+    {
+      auto& alternative = value.template emplace<I>();
+      if constexpr (!std::is_same<std::variant_alternative_t<I, T>, std::monostate>::value)
+      {
+        load_member("value", alternative, true);
+      }
+    }
+  }
+
+  /**
+   * @brief Converts \p loaded to \p T, checking that integers are in range
+   */
+  template <typename T, typename LoadT> static inline T narrow(const LoadT loaded)
+  {
+    const T value = static_cast<T>(loaded);
+    if constexpr (std::is_integral<T>::value and !std::is_same<T, LoadT>::value)
+    {
+      if (static_cast<LoadT>(value) != loaded)
+      {
+        throw std::runtime_error{"Integer value out of range"};
+      }
+    }
+    return value;
+  }
+
+  /**
+   * @brief Loads an array of numbers from an object with their type, shape and base64-encoded bytes
+   */
+  template <typename T> void load_binary_array(T& value)
+  {
+    using element_type = detail::element_type_t<T>;
+
+    std::string dtype;
+    std::vector<std::uint64_t> shape;
+    std::string data;
+    load_member("dtype", dtype, true);
+    load_member("shape", shape, true);
+    load_member("data", data, true);
+
+    const bool swapped = typed_array_dtype_swapped<element_type>(dtype);
+
+    // Shapes are read from the input, so their products are checked before they can wrap around
+    constexpr std::size_t max_size = std::numeric_limits<std::size_t>::max();
+    std::size_t size = 1;
+    for (const auto extent : shape)
+    {
+      if (extent > max_size or (extent != 0 and size > max_size / static_cast<std::size_t>(extent)))
+      {
+        throw std::runtime_error{"Typed array shape is too large"};
+      }
+      size *= static_cast<std::size_t>(extent);
+    }
+    if (size > max_size / sizeof(element_type))
+    {
+      throw std::runtime_error{"Typed array shape is too large"};
+    }
+    if (base64_decoded_size(data.data(), data.size()) != size * sizeof(element_type))
+    {
+      throw std::runtime_error{"Typed array data does not match its shape"};
+    }
+
+    if constexpr (detail::is_fixed_size_array<T>::value)
+    {
+      if (size > static_cast<std::size_t>(std::distance(std::begin(value), std::end(value))))
+      {
+        throw std::runtime_error{"Too many elements for fixed-size array"};
+      }
+    }
+    else
+    {
+      value.resize(size);
+    }
+
+    decode_base64(data.data(), data.size(), std::data(value));
+    if (swapped)
+    {
+      byte_swap(std::data(value), size, sizeof(element_type));
+    }
+  }
+
+  /**
+   * @param next_only  only checks the next member, instead of looking for \p tag in the whole object
+   *
+   * @return <code>true</code> if the member named \p tag was found, and loaded into \p value
+   */
+  template <typename T>
+  bool load_member(const char* tag, T& value, const bool required, const bool next_only = false)
+  {
+    try
+    {
+      if (next_only ? json_.ctx_find_next(tag) : json_.ctx_find(tag))
+      {
+        this->load(value);
+        json_.ctx_end(tag);
+        return true;
+      }
+      else if (required)
+      {
+        throw std::runtime_error{"Missing JSON object member"};
+      }
+      return false;
+    }
+    catch (const std::runtime_error& err)
+    {
+      std::ostringstream oss;
+      oss << '[' << tag << "] : " << err.what();
+      throw json_archive_exception{oss.str()};
+    }
+    // ctx_find --> std::logic_error intentionally not caught
+  }
+
+protected:
+  template <typename... JsonArgTs>
+  explicit basic_json_iarchive(const unsigned int flags, JsonArgTs&&... json_args) :
+      detail::common_iarchive<ArchiveT>{flags},
+      json_{std::forward<JsonArgTs>(json_args)...}
+  {}
+
+  ~basic_json_iarchive() = default;
+
+  JsonT json_;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_BASIC_JSON_IARCHIVE_H
@@ -0,0 +1,347 @@
+#ifndef BOOST_ARCHIVE_BASIC_JSON_OARCHIVE_H
+#define BOOST_ARCHIVE_BASIC_JSON_OARCHIVE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// Boost
+#include <boost/archive/detail/common_oarchive.hpp>
+
+// Boost Archive JSON
+#include <boost/archive/json_document.h>
+#include <boost/archive/json_object_schema.h>
+#include <boost/archive/json_typed_array.h>
+#include <boost/serialization/array.hpp>
+#include <boost/serialization/item_version_type.hpp>
+#include <boost/serialization/nvp.hpp>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Common save dispatch shared by all JSON output archives
+ *
+ *        \p JsonT is the output backend, which receives structural events (objects, arrays, keyed members)
+ *        and scalar values in the order they are serialized. It must provide:
+ *
+ *          - <code>ctx_start(tag)</code> / <code>ctx_end(tag)</code>
+ *          - <code>ctx_start_key(key)</code>, to start a member whose name is only known at runtime (e.g. a map key)
+ *          - <code>object_start()</code> / <code>object_start(reserve)</code> / <code>object_start(schema)</code> /
+ *            <code>object_end()</code>
+ *          - <code>array_start(reserve)</code> / <code>array_push()</code> / <code>array_end()</code>
+ *          - <code>put(value)</code> for each of the \p json_native_types, and <code>put_null()</code>
+ *          - <code>put_array<JsonNumberT>(values, size)</code>, for arrays of numbers
+ *          - <code>put_bool_array(bits, size)</code>, for <code>std::vector<bool></code> and <code>std::bitset</code>
+ *
+ *        Arrays of numbers are written in one tight loop, or as base64-encoded binary data with the
+ *        \p json_binary_arrays flag.
+ *
+ *        Standard containers are written directly, rather than as Boost's <code>count</code> and <code>item</code>
+ *        members: sequences and sets as arrays, maps with string keys as objects, other maps as arrays of
+ *        <code>[key, value]</code> pairs, empty <code>std::optional</code> values as <code>null</code>, and
+ *        <code>std::variant</code> values as an object with the index (<code>which</code>) and <code>value</code> of
+ *        the active alternative.
+ *
+ *        With the \p json_compact_metadata flag, the class information which precedes the first object of each class
+ *        (<code>_class_id_optional</code>, <code>_tracking</code> and <code>_version</code>) is held back until its
+ *        version is known, and is omitted if the class is untracked and at version 0. Loading assumes the same when
+ *        class information is missing, so output still loads as before. Pointers always keep their class information.
+ *
+ *        Objects are started with a \p json_object_schema kept for each type (and thread), which the backend may use to
+ *        build objects of the same type without looking up each member.
+ */
+template <typename ArchiveT, typename JsonT> class basic_json_oarchive : public detail::common_oarchive<ArchiveT>
+{
+public:
+  inline void save_start(const char* tag) { json_.ctx_start(tag); }
+
+  inline void save_end(const char* tag) { json_.ctx_end(tag); }
+
+  template <typename T> void save_override(const boost::serialization::nvp<T>& kv)
+  {
+    // Unnamed values (e.g. objects behind pointers) are saved into the active object, alongside their metadata
+    if (kv.name() == nullptr)
+    {
+      this->save(kv.const_value());
+      return;
+    }
+
+    try
+    {
+      json_.ctx_start(kv.name());
+      save_value(kv.const_value());
+      json_.ctx_end(kv.name());
+    }
+    catch (const std::runtime_error& err)
+    {
+      std::ostringstream oss;
+      oss << '[' << kv.name() << "] : " << err.what();
+      throw json_archive_exception{oss.str()};
+    }
+    // ctx_start --> std::logic_error intentionally not caught
+  }
+
+  template <typename T>
+  std::enable_if_t<fusion::result_of::has_key<meta_type_conversions, T>::type::value> save_override(const T& value)
+  {
+    save(value);
+  }
+
+  template <typename T>
+  std::enable_if_t<!fusion::result_of::has_key<meta_type_conversions, T>::type::value> save_override(T& value)
+  {
+    detail::common_oarchive<ArchiveT>::save_override(value);
+  }
+
+  template <typename T> void save(const T& value)
+  {
+    if constexpr (fusion::result_of::has_key<json_native_types, T>::type::value)
+    {
+      json_.put(value);
+    }
+    else if constexpr (fusion::result_of::has_key<json_conversions, T>::type::value)
+    {
+      using cast_type = typename fusion::result_of::value_at_key<json_conversions, T>::type;
+      json_.put(static_cast<cast_type>(value));
+    }
+    else if constexpr (
+      std::is_same<serialization::collection_size_type, T>::value or
+      std::is_same<serialization::item_version_type, T>::value)
+    {
+      // Collections without an array path save each element as another "item" member, which objects merge
+      static_assert(
+        !std::is_same<JsonT, json_document>::value,
+        "Collections saved element by element can only be saved with json_stream_oarchive or ndjson_oarchive");
+      json_.put(static_cast<std::uint64_t>(value));
+    }
+    else if constexpr (fusion::result_of::has_key<meta_type_conversions, T>::type::value)
+    {
+      if ((this->get_flags() & json_compact_metadata) and hold_class_info(value))
+      {
+        return;
+      }
+      save_meta(value);
+    }
+    else if constexpr (detail::is_number_array<T>::value)
+    {
+      using element_type = detail::element_type_t<T>;
+      if (this->get_flags() & json_binary_arrays)
+      {
+        save_binary_array(std::data(value), std::size(value));
+      }
+      else
+      {
+        json_.template put_array<detail::json_type_t<element_type>>(std::data(value), std::size(value));
+      }
+    }
+    else if constexpr (detail::is_std_vector_bool<T>::value or detail::is_std_bitset<T>::value)
+    {
+      json_.put_bool_array(value, value.size());
+    }
+    else if constexpr (
+      detail::is_std_vector<T>::value or detail::is_fixed_size_array<T>::value or detail::is_std_sequence<T>::value or
+      detail::is_std_forward_list<T>::value or detail::is_std_set<T>::value)
+    {
+      if constexpr (detail::is_std_forward_list<T>::value)
+      {
+        json_.array_start(static_cast<std::size_t>(std::distance(value.begin(), value.end())));
+      }
+      else
+      {
+        json_.array_start(std::size(value));
+      }
+
+      for (const auto& element : value)
+      {
+        json_.array_push();
+        save_value(element);
+      }
+
+      json_.array_end();
+    }
+    else if constexpr (detail::is_std_string_map<T>::value)
+    {
+      json_.object_start(value.size());
+
+      for (const auto& [key, mapped] : value)
+      {
+        json_.ctx_start_key(key);
+        save_value(mapped);
+        json_.ctx_end(key.c_str());
+      }
+
+      json_.object_end();
+    }
+    else if constexpr (detail::is_std_map<T>::value)
+    {
+      json_.array_start(value.size());
+
+      for (const auto& [key, mapped] : value)
+      {
+        json_.array_push();
+        json_.array_start(2);
+        json_.array_push();
+        save_value(key);
+        json_.array_push();
+        save_value(mapped);
+        json_.array_end();
+      }
+
+      json_.array_end();
+    }
+    else if constexpr (detail::is_std_optional<T>::value)
+    {
+      if (value.has_value())
+      {
+        save_value(*value);
+      }
+      else
+      {
+        json_.put_null();
+      }
+    }
+    else if constexpr (detail::is_std_variant<T>::value)
+    {
+      json_.object_start();
+      json_.ctx_start("which");
+      json_.put(static_cast<std::uint64_t>(value.index()));
+      json_.ctx_end("which");
+      std::visit(
+        [this](const auto& alternative) {
+          if constexpr (!std::is_same<std::decay_t<decltype(alternative)>, std::monostate>::value)
+          {
+            json_.ctx_start("value");
+            save_value(alternative);
+            json_.ctx_end("value");
+          }
+        },
+        value);
+      json_.object_end();
+    }
+    else
+    {
+      detail::common_oarchive<ArchiveT>::save_override(value);
+    }
+  }
+
+protected:
+  template <typename... JsonArgTs>
+  explicit basic_json_oarchive(const unsigned int flags, JsonArgTs&&... json_args) :
+      detail::common_oarchive<ArchiveT>{flags},
+      json_{std::forward<JsonArgTs>(json_args)...}
+  {}
+
+  ~basic_json_oarchive() = default;
+
+  JsonT json_;
+
+private:
+  template <typename T> void save_meta(const T& value)
+  {
+    using cast_type = typename fusion::result_of::value_at_key<meta_type_conversions, T>::type;
+    auto cast_value = static_cast<cast_type>(value);
+    save_override(boost::serialization::make_nvp(fusion::at_key<T>(meta_type_names), cast_value));
+  }
+
+  /**
+   * @brief Holds back class information until its version is known, then saves all of it unless it can be omitted
+   *
+   * @return <code>true</code> if \p value was held back or omitted, rather than left to be saved
+   */
+  template <typename T> bool hold_class_info(const T& value)
+  {
+    if constexpr (std::is_same<class_id_optional_type, T>::value)
+    {
+      held_class_id_ = value;
+      return true;
+    }
+    else if constexpr (std::is_same<tracking_type, T>::value)
+    {
+      held_tracking_ = value;
+      return held_class_id_.has_value();
+    }
+    else if constexpr (std::is_same<version_type, T>::value)
+    {
+      if (!held_class_id_.has_value())
+      {
+        return false;
+      }
+      const class_id_optional_type class_id = *held_class_id_;
+      held_class_id_.reset();
+      if (!held_tracking_ and static_cast<unsigned int>(value) == 0)
+      {
+        return true;
+      }
+      save_meta(class_id);
+      save_meta(held_tracking_);
+      return false;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * @brief Returns the schema of objects of type \p T saved on this thread
+   */
+  template <typename T> static json_object_schema& object_schema()
+  {
+    static thread_local json_object_schema schema;
+    return schema;
+  }
+
+  /**
+   * @brief Saves \p value to the active value, first starting an object unless it is saved as a single value
+   */
+  template <typename T> void save_value(const T& value)
+  {
+    if constexpr (detail::is_single_value<T>::value)
+    {
+      this->save(value);
+    }
+    else
+    {
+      json_.object_start(object_schema<T>());
+      this->save(value);
+      json_.object_end();
+    }
+  }
+
+  /**
+   * @brief Saves \p size numbers at \p values as an object with their type, shape and base64-encoded bytes
+   */
+  template <typename NumberT> void save_binary_array(const NumberT* values, const std::size_t size)
+  {
+    const std::string dtype = typed_array_dtype<NumberT>();
+    const std::uint64_t shape[1] = {size};
+    const std::string data = encode_base64(values, size * sizeof(NumberT));
+
+    json_.object_start();
+    save_override(boost::serialization::make_nvp("dtype", dtype));
+    json_.ctx_start("shape");
+    json_.template put_array<std::uint64_t>(shape, 1);
+    json_.ctx_end("shape");
+    save_override(boost::serialization::make_nvp("data", data));
+    json_.object_end();
+  }
+
+  /// Class information held back with \p json_compact_metadata
+  std::optional<class_id_optional_type> held_class_id_;
+  tracking_type held_tracking_;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_BASIC_JSON_OARCHIVE_H
@@ -0,0 +1,65 @@
+#ifndef BOOST_ARCHIVE_JSON_ARCHIVE_BUFFERS_H
+#define BOOST_ARCHIVE_JSON_ARCHIVE_BUFFERS_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Memory kept from one archive to the next, for archives which are constructed for each of many small messages
+ *
+ *        Boost.Serialization keeps object tracking and class information for the lifetime of an archive, so an
+ *        archive cannot be reset between messages without sharing them. Instead, archives constructed with buffers
+ *        borrow their memory while they exist: documents are allocated from arenas whose blocks are recycled by
+ *        \p resource, output is collected in one reused block, and input read from streams into one reused string.
+ *
+ *        Buffers may only be lent to one archive at a time, and must outlive it. Blocks are recycled without locking,
+ *        so archives which borrow buffers can not use \p json_parallel_parse.
+ */
+class json_archive_buffers
+{
+public:
+  /// Blocks up to this size are recycled; larger blocks are requested from upstream every time
+  static constexpr std::size_t max_recycled_block_size = 1 << 20;
+
+  explicit json_archive_buffers(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) :
+      blocks_{std::pmr::pool_options{0, max_recycled_block_size}, upstream}
+  {}
+
+  json_archive_buffers(const json_archive_buffers&) = delete;
+
+  ~json_archive_buffers() = default;
+
+  /**
+   * @brief Returns the resource from which archive arenas request their blocks
+   */
+  inline std::pmr::memory_resource* resource() { return std::addressof(blocks_); }
+
+  /**
+   * @brief Returns the block in which output is collected before it is handed to a sink
+   */
+  inline std::vector<char>& output_block() { return output_block_; }
+
+  /**
+   * @brief Returns the string into which input is read from a stream
+   */
+  inline std::string& input_text() { return input_text_; }
+
+private:
+  std::pmr::unsynchronized_pool_resource blocks_;
+  std::vector<char> output_block_;
+  std::string input_text_;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_ARCHIVE_BUFFERS_H
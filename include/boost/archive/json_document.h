@@ -0,0 +1,640 @@
+#ifndef BOOST_ARCHIVE_JSON_DOCUMENT_H
+#define BOOST_ARCHIVE_JSON_DOCUMENT_H
+
+// C++ Standard Library
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+
+// Boost
+#include <boost/archive/basic_archive.hpp>
+#include <boost/fusion/container/map.hpp>
+#include <boost/fusion/container/set.hpp>
+#include <boost/fusion/include/at_key.hpp>
+#include <boost/fusion/include/has_key.hpp>
+#include <boost/fusion/include/value_at_key.hpp>
+#include <boost/serialization/collection_size_type.hpp>
+#include <boost/serialization/item_version_type.hpp>
+
+// Boost Archive JSON
+#include <boost/archive/json_inline_stack.h>
+#include <boost/archive/json_object_schema.h>
+#include <boost/archive/json_value.h>
+
+// Define BOOST_ARCHIVE_JSON_CHECKED to keep checking the active value of a json_document in builds with NDEBUG
+#if !defined(NDEBUG) or defined(BOOST_ARCHIVE_JSON_CHECKED)
+#define BOOST_ARCHIVE_JSON_CHECK_ACTIVE 1
+#endif
+
+// Forward Declarations
+namespace std
+{
+
+template <class T, std::size_t N> class array;
+template <class T, class AllocatorT> class vector;
+
+}  // namespace std
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Counts how often \p json_document::ctx_find found a member at the position following the last one found
+ */
+struct json_lookup_stats
+{
+  /// Lookups resolved by checking a single member
+  std::size_t cursor_hits = 0;
+
+  /// Lookups which fell back to searching the whole object
+  std::size_t cursor_misses = 0;
+};
+
+/**
+ * @brief In-memory JSON document, with a stack of active values used by the archives to build or walk it
+ *
+ *        Values created by the document are allocated from a monotonic arena, which is released all at once when
+ *        the document is destroyed. The arena requests blocks from \p upstream. Storage which is freed while the
+ *        document is being built (e.g. when an object or array outgrows its capacity) is pooled and reused.
+ */
+class json_document
+{
+public:
+  /**
+   * @brief Parses a \p json_value::deferred value in place, allocating from \p resource
+   */
+  using deferred_parser = void (*)(json_value& value, std::pmr::memory_resource* resource);
+
+  explicit json_document(json_value root);
+
+  explicit json_document(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+  json_document(const json_document&) = delete;
+
+  ~json_document() = default;
+
+  /**
+   * @brief Makes the member named \p tag active, appending it to the active object if it does not exist yet
+   *
+   *        If the active object was started with a schema, names found in the schema are appended directly.
+   */
+  void ctx_start(const char* tag);
+
+  /**
+   * @brief Makes the existing member named \p tag active
+   *
+   *        Members are usually loaded in the order in which they were saved, so the member following the one found
+   *        last in the active object is checked before falling back to a full lookup.
+   *
+   * @return <code>false</code>, leaving the active value unchanged, if there is no such member
+   */
+  bool ctx_find(const char* tag);
+
+  /**
+   * @brief Makes the member named \p tag active only if it follows the member found last in the active object
+   *
+   *        Used for optional members which are always saved ahead of the others (i.e. archive metadata), so that
+   *        missing members are not looked for in the whole object.
+   *
+   * @return <code>false</code>, leaving the active value unchanged, if the next member has another name
+   */
+  bool ctx_find_next(const char* tag);
+
+  /**
+   * @brief Makes a new member named \p key active, appending it to the active object
+   *
+   *        Used for names which are only known at runtime (e.g. map keys). \p key must not be the name of an existing
+   *        member, since the member is appended without looking for one.
+   */
+  void ctx_start_key(const std::string_view key);
+
+  void ctx_end(const char* tag);
+
+  /**
+   * @brief Makes \p value active, first parsing it with the \p deferred_parser if it is deferred
+   */
+  void ctx_push(json_value& value);
+
+  inline void ctx_pop() { ctx_stack_.pop(); }
+
+  void object_start();
+
+  /**
+   * @brief Makes the active value an empty object, with room for \p reserve members
+   */
+  void object_start(const std::size_t reserve);
+
+  /**
+   * @brief Makes the active value an empty object, whose members are appended using \p schema
+   *
+   *        An empty schema is recorded from this object, and is complete once the object ends.
+   */
+  void object_start(json_object_schema& schema);
+
+  inline void object_end()
+  {
+    if (auto* const schema = ctx_stack_.top().schema;
+        schema != nullptr and schema->status() == json_object_schema::state::recording)
+    {
+      schema->finish();
+    }
+  }
+
+  void array_start(const std::size_t reserve);
+
+  void array_end();
+
+  void array_push();
+
+  void array_next();
+
+  /**
+   * @brief Returns the active value
+   *
+   *        Unless built with \p NDEBUG, throws \p std::logic_error if there is no active value, or if an array was
+   *        started without pushing an element to it.
+   */
+  inline json_value& active()
+  {
+#ifdef BOOST_ARCHIVE_JSON_CHECK_ACTIVE
+    check_active();
+#endif  // BOOST_ARCHIVE_JSON_CHECK_ACTIVE
+    return *ctx_stack_.top().value;
+  }
+
+  inline json_value& root() { return root_; }
+
+  /**
+   * @brief Returns the arena from which values in this document should be allocated
+   */
+  inline std::pmr::memory_resource* resource() { return std::addressof(pool_); }
+
+  /**
+   * @brief Returns a new arena, released with the document, from which values can be built on another thread
+   *
+   *        Each arena may only be used by one thread at a time, and requests blocks from the same upstream resource
+   *        as the document, which must then be safe to use from several threads at once.
+   */
+  std::pmr::memory_resource* add_thread_resource();
+
+  template <typename T> inline void put(const T& value) { active() = json_value{value}; }
+
+  inline void put(const std::string& value) { active() = json_value{json_value::string{value, resource()}}; }
+
+  inline void put_null() { active() = json_value{}; }
+
+  /**
+   * @brief Returns active value as one of the \p json_native_types; numbers are converted between representations
+   */
+  template <typename T> inline decltype(auto) get()
+  {
+    if constexpr (std::is_arithmetic<T>::value and !std::is_same<T, bool>::value)
+    {
+      return active().to_number<T>();
+    }
+    else if constexpr (std::is_same<T, std::string>::value)
+    {
+      const auto& str = active().get<json_value::string>();
+      return std::string_view{str.data(), str.size()};
+    }
+    else
+    {
+      return static_cast<const T&>(active().get<T>());
+    }
+  }
+
+  /**
+   * @brief Makes the active value an array of \p size numbers at \p values, each converted to \p JsonNumberT
+   */
+  template <typename JsonNumberT, typename NumberT> void put_array(const NumberT* values, const std::size_t size)
+  {
+    active() = json_value{json_value::array{resource()}};
+    auto& arr_ctx = active().get<json_value::array>();
+    arr_ctx.reserve(size);
+    for (std::size_t n = 0; n < size; ++n)
+    {
+      arr_ctx.emplace_back(static_cast<JsonNumberT>(values[n]));
+    }
+  }
+
+  /**
+   * @brief Makes the active value an array of the \p size booleans <code>bits[0]</code> to <code>bits[size - 1]</code>
+   */
+  template <typename BitsT> void put_bool_array(const BitsT& bits, const std::size_t size)
+  {
+    active() = json_value{json_value::array{resource()}};
+    auto& arr_ctx = active().get<json_value::array>();
+    arr_ctx.reserve(size);
+    for (std::size_t n = 0; n < size; ++n)
+    {
+      arr_ctx.emplace_back(static_cast<bool>(bits[n]));
+    }
+  }
+
+  inline bool is_object() { return active().is<json_value::object>(); }
+
+  inline bool is_null() { return active().is<json_value::null>(); }
+
+  inline std::size_t array_size() { return active().get<json_value::array>().size(); }
+
+  inline std::size_t object_size() { return active().get<json_value::object>().size(); }
+
+  template <typename ElementLoaderT> void array_for_each(ElementLoaderT&& load_element)
+  {
+    for (auto& element : active().get<json_value::array>())
+    {
+      ctx_push(element);
+      load_element();
+      ctx_pop();
+    }
+  }
+
+  /**
+   * @brief Makes each member of the active object active in turn, passing its name to \p load_member
+   */
+  template <typename MemberLoaderT> void object_for_each(MemberLoaderT&& load_member)
+  {
+    auto& obj = active().get<json_value::object>();
+    for (std::size_t n = 0; n < obj.size(); ++n)
+    {
+      auto& member = obj[n];
+      ctx_push(member.second);
+      load_member(std::string_view{member.first});
+      ctx_pop();
+    }
+  }
+
+  /**
+   * @brief Passes each element of the active array to \p store as a <code>bool</code>
+   */
+  template <typename StoreT> void array_for_each_bool(StoreT&& store)
+  {
+    for (const auto& element : active().get<json_value::array>())
+    {
+      store(element.get<bool>());
+    }
+  }
+
+  /**
+   * @brief Passes each element of the active array to \p store as a \p JsonNumberT
+   */
+  template <typename JsonNumberT, typename StoreT> void array_for_each_number(StoreT&& store)
+  {
+    for (const auto& element : active().get<json_value::array>())
+    {
+      store(element.to_number<JsonNumberT>());
+    }
+  }
+
+  inline void serialize(json_output_buffer& out, const bool prettify, json_worker_pool* workers = nullptr) const
+  {
+    root_.serialize(out, prettify, workers);
+  }
+
+  inline const json_lookup_stats& lookup_stats() const { return lookup_stats_; }
+
+  /**
+   * @brief Sets the parser for \p json_value::deferred values, which are otherwise left as they are
+   */
+  inline void set_deferred_parser(const deferred_parser parser) { deferred_parser_ = parser; }
+
+private:
+  /**
+   * @brief Active value, and the position at which the next member of that value is expected, if it is an object
+   *
+   *        While saving, the position is in the schema the object was started with, if any.
+   */
+  struct context
+  {
+    json_value* value;
+    std::size_t cursor;
+    json_object_schema* schema;
+  };
+
+  /// Enough for all but unusually deeply nested values, without allocating
+  static constexpr std::size_t ctx_stack_inline_capacity = 32;
+
+  void check_active() const;
+
+  /**
+   * @brief Returns the member named \p tag of \p object, which is active in \p ctx, appending it if needed
+   */
+  json_value& schema_emplace(context& ctx, json_object& object, const char* tag);
+
+  std::pmr::monotonic_buffer_resource arena_;
+  std::pmr::unsynchronized_pool_resource pool_;
+  std::forward_list<std::pmr::monotonic_buffer_resource> thread_arenas_;
+  json_inline_stack<context, ctx_stack_inline_capacity> ctx_stack_;
+  json_value root_;
+  json_lookup_stats lookup_stats_;
+  deferred_parser deferred_parser_ = nullptr;
+};
+
+using json_native_types = fusion::set<bool, std::int64_t, std::uint64_t, float, double, std::string>;
+
+using json_signed_integer_type = std::int64_t;
+
+using json_unsigned_integer_type = std::uint64_t;
+
+using json_conversions = fusion::map<
+  fusion::pair<short, json_signed_integer_type>,
+  fusion::pair<unsigned short, json_unsigned_integer_type>,
+  fusion::pair<int, json_signed_integer_type>,
+  fusion::pair<unsigned int, json_unsigned_integer_type>,
+  fusion::pair<long, json_signed_integer_type>,
+  fusion::pair<unsigned long, json_unsigned_integer_type>,
+  fusion::pair<long long, json_signed_integer_type>,
+  fusion::pair<unsigned long long, json_unsigned_integer_type>,
+  fusion::pair<signed char, json_signed_integer_type>,
+  fusion::pair<unsigned char, json_unsigned_integer_type>,
+  fusion::pair<wchar_t, json_signed_integer_type>>;
+
+using meta_type_conversions = fusion::map<
+  fusion::pair<archive::class_id_type, json_signed_integer_type>,
+  fusion::pair<archive::class_id_optional_type, json_signed_integer_type>,
+  fusion::pair<archive::class_id_reference_type, json_signed_integer_type>,
+  fusion::pair<archive::object_id_type, json_unsigned_integer_type>,
+  fusion::pair<archive::object_reference_type, json_unsigned_integer_type>,
+  fusion::pair<archive::version_type, json_unsigned_integer_type>,
+  fusion::pair<archive::tracking_type, bool>,
+  fusion::pair<archive::class_name_type, std::string>>;
+
+using meta_type_names_t = fusion::map<
+  fusion::pair<archive::class_id_type, char const*>,
+  fusion::pair<archive::class_id_optional_type, char const*>,
+  fusion::pair<archive::class_id_reference_type, char const*>,
+  fusion::pair<archive::object_id_type, char const*>,
+  fusion::pair<archive::object_reference_type, char const*>,
+  fusion::pair<archive::version_type, char const*>,
+  fusion::pair<archive::tracking_type, char const*>,
+  fusion::pair<archive::class_name_type, char const*>>;
+
+const meta_type_names_t meta_type_names{fusion::make_pair<archive::class_id_type>("_class_id"),
+                                        fusion::make_pair<archive::class_id_optional_type>("_class_id_optional"),
+                                        fusion::make_pair<archive::class_id_reference_type>("_class_id_reference"),
+                                        fusion::make_pair<archive::object_id_type>("_object_id"),
+                                        fusion::make_pair<archive::object_reference_type>("_object_reference"),
+                                        fusion::make_pair<archive::version_type>("_version"),
+                                        fusion::make_pair<archive::tracking_type>("_tracking"),
+                                        fusion::make_pair<archive::class_name_type>("_class_name")};
+
+/**
+ * @brief Flags specific to the JSON archives, following the standard <code>boost::archive::archive_flags</code>
+ */
+enum json_archive_flags : unsigned int
+{
+  /// Save arrays of numbers as <code>{"dtype", "shape", "data"}</code> objects, with base64-encoded binary data
+  json_binary_arrays = (flags_last << 1),
+  /// Parse input to json_iarchive by first indexing all of its tokens in one vectorized pass
+  json_indexed_parse = (flags_last << 2),
+  /// Parse objects and arrays in input to json_iarchive only once values are loaded from them
+  json_lazy_parse = (flags_last << 3),
+  /// Parse large arrays in input to json_iarchive on several threads
+  json_parallel_parse = (flags_last << 4),
+  /// Format large arrays on several threads when json_oarchive writes its output
+  json_parallel_serialize = (flags_last << 5),
+  /// Omit class information when it matches what loading assumes when it is missing (i.e. untracked, version 0)
+  json_compact_metadata = (flags_last << 6),
+};
+
+class json_archive_exception final : public std::exception
+{
+public:
+  explicit json_archive_exception(std::string reason) : reason_{std::move(reason)} {}
+
+  const char* what() const noexcept override { return reason_.c_str(); };
+
+private:
+  std::string reason_;
+};
+
+namespace detail
+{
+
+template <typename T> struct is_std_vector_bool : std::integral_constant<bool, false>
+{};
+
+template <typename... OtherTs>
+struct is_std_vector_bool<std::vector<bool, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename T> struct is_fixed_size_array : std::integral_constant<bool, std::is_array<T>::value>
+{};
+
+template <typename T> struct is_std_bitset : std::integral_constant<bool, false>
+{};
+
+template <std::size_t N> struct is_std_bitset<std::bitset<N>> : std::integral_constant<bool, true>
+{};
+
+template <typename T, std::size_t N> struct is_fixed_size_array<std::array<T, N>> : std::integral_constant<bool, true>
+{};
+
+template <typename T> struct is_std_vector : std::integral_constant<bool, false>
+{};
+
+template <typename T, typename... OtherTs>
+struct is_std_vector<std::vector<T, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename T> struct is_element_native_convertible : std::integral_constant<bool, false>
+{};
+
+template <typename T, std::size_t N>
+struct is_element_native_convertible<T[N]> : std::integral_constant<
+                                               bool,
+                                               (fusion::result_of::has_key<json_native_types, T>::type::value or
+                                                fusion::result_of::has_key<json_conversions, T>::type::value)>
+{};
+
+template <typename T, std::size_t N>
+struct is_element_native_convertible<std::array<T, N>>
+    : std::integral_constant<
+        bool,
+        (fusion::result_of::has_key<json_native_types, T>::type::value or
+         fusion::result_of::has_key<json_conversions, T>::type::value)>
+{};
+
+template <typename T, typename... OtherTs>
+struct is_element_native_convertible<std::vector<T, OtherTs...>>
+    : std::integral_constant<
+        bool,
+        (fusion::result_of::has_key<json_native_types, T>::type::value or
+         fusion::result_of::has_key<json_conversions, T>::type::value)>
+{};
+
+template <typename T>
+using element_type_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(std::declval<T&>()))>>;
+
+/**
+ * @brief Contiguous arrays of numbers, which are saved and loaded in bulk
+ */
+template <typename T, bool = is_element_native_convertible<T>::value>
+struct is_number_array : std::integral_constant<bool, false>
+{};
+
+template <typename T>
+struct is_number_array<T, true>
+    : std::integral_constant<
+        bool,
+        (std::is_arithmetic<element_type_t<T>>::value and !std::is_same<element_type_t<T>, bool>::value)>
+{};
+
+/**
+ * @brief Sequence containers other than <code>std::vector</code>, which are saved as arrays
+ */
+template <typename T> struct is_std_sequence : std::integral_constant<bool, false>
+{};
+
+template <typename T, typename... OtherTs>
+struct is_std_sequence<std::deque<T, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename T, typename... OtherTs>
+struct is_std_sequence<std::list<T, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+/**
+ * @brief Singly-linked lists, which are saved as arrays, and loaded by inserting each element after the last
+ */
+template <typename T> struct is_std_forward_list : std::integral_constant<bool, false>
+{};
+
+template <typename T, typename... OtherTs>
+struct is_std_forward_list<std::forward_list<T, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+/**
+ * @brief Sets, which are saved as arrays
+ */
+template <typename T> struct is_std_set : std::integral_constant<bool, false>
+{};
+
+template <typename T, typename... OtherTs>
+struct is_std_set<std::set<T, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename T, typename... OtherTs>
+struct is_std_set<std::multiset<T, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename T, typename... OtherTs>
+struct is_std_set<std::unordered_set<T, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename T, typename... OtherTs>
+struct is_std_set<std::unordered_multiset<T, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+/**
+ * @brief Maps, which are saved as objects if \p is_std_string_map, or else as arrays of <code>[key, value]</code> pairs
+ */
+template <typename T> struct is_std_map : std::integral_constant<bool, false>
+{};
+
+template <typename KeyT, typename ValueT, typename... OtherTs>
+struct is_std_map<std::map<KeyT, ValueT, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename KeyT, typename ValueT, typename... OtherTs>
+struct is_std_map<std::multimap<KeyT, ValueT, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename KeyT, typename ValueT, typename... OtherTs>
+struct is_std_map<std::unordered_map<KeyT, ValueT, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename KeyT, typename ValueT, typename... OtherTs>
+struct is_std_map<std::unordered_multimap<KeyT, ValueT, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+/**
+ * @brief Maps with unique string keys, which are saved as objects; keys which may repeat are saved as pairs
+ */
+template <typename T> struct is_std_string_map : std::integral_constant<bool, false>
+{};
+
+template <typename ValueT, typename... OtherTs>
+struct is_std_string_map<std::map<std::string, ValueT, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename ValueT, typename... OtherTs>
+struct is_std_string_map<std::unordered_map<std::string, ValueT, OtherTs...>> : std::integral_constant<bool, true>
+{};
+
+template <typename T, typename = void> struct has_reserve : std::integral_constant<bool, false>
+{};
+
+template <typename T>
+struct has_reserve<T, std::void_t<decltype(std::declval<T&>().reserve(std::size_t{}))>>
+    : std::integral_constant<bool, true>
+{};
+
+template <typename T> struct is_std_optional : std::integral_constant<bool, false>
+{};
+
+template <typename T> struct is_std_optional<std::optional<T>> : std::integral_constant<bool, true>
+{};
+
+template <typename T> struct is_std_variant : std::integral_constant<bool, false>
+{};
+
+template <typename... Ts> struct is_std_variant<std::variant<Ts...>> : std::integral_constant<bool, true>
+{};
+
+/**
+ * @brief Values which are saved as one JSON value (e.g. a number, string or array), rather than as an object
+ *
+ *        Maps and variants are saved as objects, but start them on their own.
+ */
+template <typename T>
+struct is_single_value
+    : std::integral_constant<
+        bool,
+        (fusion::result_of::has_key<json_native_types, T>::type::value or
+         fusion::result_of::has_key<json_conversions, T>::type::value or std::is_enum<T>::value or
+         is_std_vector<T>::value or is_fixed_size_array<T>::value or is_std_bitset<T>::value or
+         is_std_sequence<T>::value or is_std_forward_list<T>::value or is_std_set<T>::value or is_std_map<T>::value or
+         is_std_optional<T>::value or is_std_variant<T>::value)>
+{};
+
+/**
+ * @brief One of the \p json_native_types which is used to represent values of type \p T
+ */
+template <typename T, typename = void> struct json_type
+{
+  using type = T;
+};
+
+template <typename T>
+struct json_type<T, std::enable_if_t<fusion::result_of::has_key<json_conversions, T>::type::value>>
+{
+  using type = typename fusion::result_of::value_at_key<json_conversions, T>::type;
+};
+
+template <typename T> using json_type_t = typename json_type<T>::type;
+
+}  // namespace detail
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_DOCUMENT_H
@@ -0,0 +1,45 @@
+#ifndef BOOST_ARCHIVE_JSON_FORMAT_H
+#define BOOST_ARCHIVE_JSON_FORMAT_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+
+// Boost Archive JSON
+#include <boost/archive/json_output_buffer.h>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Writes \p len characters at \p str as a quoted, escaped JSON string
+ */
+void write_json_string(json_output_buffer& out, const char* str, const std::size_t len);
+
+void write_json_number(json_output_buffer& out, const std::int64_t value);
+
+void write_json_number(json_output_buffer& out, const std::uint64_t value);
+
+/**
+ * @brief Writes the shortest representation of a finite \p value which reads back as the same float; throws
+ *        <code>std::overflow_error</code> for NaN and infinities
+ */
+void write_json_number(json_output_buffer& out, const float value);
+
+/**
+ * @brief Writes the shortest representation of a finite \p value which reads back as the same double; throws
+ *        <code>std::overflow_error</code> for NaN and infinities
+ */
+void write_json_number(json_output_buffer& out, const double value);
+
+/**
+ * @brief Writes a line break, followed by \p depth levels of indentation
+ */
+void write_json_indent(json_output_buffer& out, const std::size_t depth);
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_FORMAT_H
@@ -2,138 +2,111 @@
 #define BOOST_ARCHIVE_JSON_IARCHIVE_H
 
 // C++ Standard Library
-#include <iterator>
+#include <cstddef>
+#include <filesystem>
 #include <istream>
-#include <sstream>
+#include <memory_resource>
+#include <optional>
+#include <string>
 
 // Boost
 #include <boost/archive/detail/register_archive.hpp>
 
-// Boost
-#include <boost/archive/detail/common_iarchive.hpp>
-#include <boost/archive/detail/register_archive.hpp>
-
 // Boost Archive JSON
-#include <boost/archive/picojson_wrapper.h>
-#include <boost/serialization/array.hpp>
-#include <boost/serialization/item_version_type.hpp>
-#include <boost/serialization/nvp.hpp>
+#include <boost/archive/basic_json_iarchive.h>
+#include <boost/archive/json_archive_buffers.h>
+#include <boost/archive/json_document.h>
+#include <boost/archive/json_mapped_file.h>
 
 namespace boost
 {
 namespace archive
 {
 
-class json_iarchive : public detail::common_iarchive<json_iarchive>
+/**
+ * @brief Parses a full JSON document on construction, then loads values from it
+ *
+ *        Throws \p json_archive_exception on construction if the input is not valid JSON. The parsed document is
+ *        allocated from an arena which requests memory from \p upstream, and is released all at once when the archive
+ *        is destroyed.
+ *
+ *        Archives constructed for each of many small messages can instead borrow \p json_archive_buffers, and reuse
+ *        their memory from one message to the next.
+ *
+ *        With \p json_indexed_parse, the input is first indexed by \p json_structural_index, and parsed by jumping
+ *        between the indexed tokens. Inputs too large to index are parsed normally.
+ *
+ *        With \p json_lazy_parse, only the outermost value is parsed on construction. Objects and arrays inside of
+ *        it are skipped by matching brackets, and each is parsed, one level at a time, once a value is first loaded
+ *        from it. Input which is never loaded from is not validated. The input is kept for the lifetime of the
+ *        archive, and takes precedence over \p json_indexed_parse.
+ *
+ *        With \p json_parallel_parse, large arrays which are members of the outermost object (i.e. those saved
+ *        directly to the archive) are split between one thread per hardware thread. The threads are started once, and
+ *        shared by all of these arrays. Elements are still loaded one at a time, so object tracking and class
+ *        versions behave as they would otherwise. \p upstream must be safe to use from several threads at once. This
+ *        takes precedence over \p json_indexed_parse.
+ */
+class json_iarchive : public basic_json_iarchive<json_iarchive, json_document>
 {
 public:
-  explicit json_iarchive(std::istream& is);
+  /**
+   * @brief Reads all of \p is into one contiguous buffer before parsing
+   *
+   * @param flags  <code>boost::archive::archive_flags</code> and \p json_archive_flags
+   */
+  explicit json_iarchive(
+    std::istream& is,
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+    const unsigned int flags = 0);
+
+  /**
+   * @brief Parses JSON directly from \p size characters at \p data, which need only outlive construction
+   *
+   *        With \p json_lazy_parse, \p data must instead outlive the archive.
+   */
+  json_iarchive(
+    const char* data,
+    const std::size_t size,
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+    const unsigned int flags = 0);
+
+  /**
+   * @brief Reads all of \p is into the input buffer of \p buffers, which must outlive the archive, before parsing
+   *
+   *        Throws \p std::invalid_argument if \p flags include \p json_parallel_parse
+   */
+  json_iarchive(std::istream& is, json_archive_buffers& buffers, const unsigned int flags = 0);
+
+  /**
+   * @brief Parses JSON directly from \p size characters at \p data, borrowing \p buffers, which must outlive the
+   *        archive
+   *
+   *        Throws \p std::invalid_argument if \p flags include \p json_parallel_parse
+   */
+  json_iarchive(const char* data, const std::size_t size, json_archive_buffers& buffers, const unsigned int flags = 0);
+
+  /**
+   * @brief Memory-maps the file at \p path and parses JSON directly from the mapping
+   */
+  explicit json_iarchive(
+    const std::filesystem::path& path,
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+    const unsigned int flags = 0);
 
   ~json_iarchive() = default;
 
-  inline void load_start(const char* tag) { json_.ctx_start(tag); }
-
-  inline void load_end(const char* tag) { json_.ctx_end(tag); }
-
-  template <typename T> void load_override(const boost::serialization::nvp<T>& kv)
-  {
-    try
-    {
-      json_.ctx_start(kv.name());
-      this->load(kv.value());
-      json_.ctx_end(kv.name());
-    }
-    catch (const std::runtime_error& err)
-    {
-      std::ostringstream oss;
-      oss << '[' << kv.name() << "] : " << err.what();
-      throw json_archive_exception{oss.str()};
-    }
-    // ctx_start --> std::logic_error intentionally not caught
-  }
-
-  template <typename T>
-  std::enable_if_t<fusion::result_of::has_key<meta_type_conversions, T>::type::value> load_override(T& value)
-  {
-    load(value);
-  }
-
-  template <typename T>
-  std::enable_if_t<!fusion::result_of::has_key<meta_type_conversions, T>::type::value> load_override(T& value)
-  {
-    detail::common_iarchive<json_iarchive>::load_override(value);
-  }
-
-  template <typename T> void load(T& value)
-  {
-    if constexpr (fusion::result_of::has_key<picojson_native_types, T>::type::value)
-    {
-      value = json_.active().get<T>();
-    }
-    else if constexpr (fusion::result_of::has_key<picojson_conversions, T>::type::value)
-    {
-      using load_type = typename fusion::result_of::value_at_key<picojson_conversions, T>::type;
-      value = static_cast<T>(json_.active().template get<load_type>());
-    }
-    else if constexpr (std::is_same<class_name_type, T>::value)
-    {
-      value = class_name_type{json_.active().template get<std::string>().c_str()};
-    }
-    else if constexpr (std::is_same<serialization::collection_size_type, T>::value)
-    {
-      value = static_cast<std::size_t>(json_.active().template get<picojson_real_number_type>());
-    }
-    else if constexpr (fusion::result_of::has_key<meta_type_conversions, T>::type::value)
-    {
-      /// ???
-    }
-    else if constexpr (detail::is_fixed_size_array<T>::value)
-    {
-      auto& read_value_array = json_.active().get<picojson::array>();
-      auto witr = std::begin(value);
-
-      for (auto& v : read_value_array)
-      {
-        json_.ctx_push(v);
-        this->load(*witr++);
-        json_.ctx_pop();
-      }
-    }
-    else if constexpr (detail::is_std_vector_bool<T>::value)
-    {
-      auto& read_value_array = json_.active().get<picojson::array>();
-      value.reserve(read_value_array.size());
-
-      for (auto& v : read_value_array)
-      {
-        json_.ctx_push(v);
-        bool dst;
-        this->load(dst);
-        value.push_back(dst);
-        json_.ctx_pop();
-      }
-    }
-    else if constexpr (detail::is_std_vector<T>::value)
-    {
-      auto& read_value_array = json_.active().get<picojson::array>();
-      value.resize(read_value_array.size());
-
-      auto witr = value.begin();
-      for (auto& v : read_value_array)
-      {
-        json_.ctx_push(v);
-        this->load(*witr++);
-        json_.ctx_pop();
-      }
-    }
-    else
-    {
-      detail::common_iarchive<json_iarchive>::load_override(value);
-    }
-  }
+  /**
+   * @brief Returns how many member lookups were resolved at the position following the previously loaded member
+   */
+  inline const json_lookup_stats& lookup_stats() const { return json_.lookup_stats(); }
 
 private:
-  picojson_wrapper json_;
+  /// Input read from a stream, kept with \p json_lazy_parse
+  std::string text_;
+
+  /// Input mapped from a file, kept with \p json_lazy_parse
+  std::optional<json_mapped_file> file_;
 };
 
 }  // archive
@@ -141,4 +114,4 @@ private:
 
 BOOST_SERIALIZATION_REGISTER_ARCHIVE(boost::archive::json_iarchive)
 
-#endif  // BOOST_ARCHIVE_JSON_IARCHIVE_H
\ No newline at end of file
+#endif  // BOOST_ARCHIVE_JSON_IARCHIVE_H
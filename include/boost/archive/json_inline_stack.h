@@ -0,0 +1,70 @@
+#ifndef BOOST_ARCHIVE_JSON_INLINE_STACK_H
+#define BOOST_ARCHIVE_JSON_INLINE_STACK_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Stack which stores up to \p InlineCapacity values in place, and moves to the heap only when it grows past that
+ *
+ *        Values are stored in contiguous memory, which doubles in size whenever the stack is full.
+ */
+template <typename T, std::size_t InlineCapacity> class json_inline_stack
+{
+  static_assert(std::is_trivially_copyable<T>::value, "Inline stack values must be trivially copyable");
+
+public:
+  json_inline_stack() = default;
+
+  json_inline_stack(const json_inline_stack&) = delete;
+
+  ~json_inline_stack() = default;
+
+  inline void push(const T& value)
+  {
+    if (size_ == capacity_)
+    {
+      grow();
+    }
+    data_[size_++] = value;
+  }
+
+  inline void pop() { --size_; }
+
+  inline T& top() { return data_[size_ - 1]; }
+
+  inline const T& top() const { return data_[size_ - 1]; }
+
+  inline bool empty() const { return size_ == 0; }
+
+  inline std::size_t size() const { return size_; }
+
+private:
+  void grow()
+  {
+    std::unique_ptr<T[]> grown{new T[capacity_ * 2]};
+    std::copy(data_, data_ + size_, grown.get());
+    heap_ = std::move(grown);
+    data_ = heap_.get();
+    capacity_ *= 2;
+  }
+
+  T inline_[InlineCapacity];
+  std::unique_ptr<T[]> heap_;
+  T* data_ = inline_;
+  std::size_t size_ = 0;
+  std::size_t capacity_ = InlineCapacity;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_INLINE_STACK_H
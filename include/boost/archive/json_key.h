@@ -0,0 +1,36 @@
+#ifndef BOOST_ARCHIVE_JSON_KEY_H
+#define BOOST_ARCHIVE_JSON_KEY_H
+
+// C++ Standard Library
+#include <string_view>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Name of an object member, along with the text written ahead of the member's value
+ */
+struct json_key
+{
+  /// Unescaped name
+  std::string_view name;
+
+  /// Name as a quoted, escaped JSON string, followed by <code>:</code>
+  std::string_view prefix;
+};
+
+/**
+ * @brief Returns the member named by the null-terminated \p tag, valid until the next call on the same thread
+ *
+ *        Keys are cached per thread by the address of \p tag, since nvp names are almost always string literals, so
+ *        repeated names are neither measured nor escaped again. Cached keys are checked against the contents of
+ *        \p tag, so names which are built at runtime are still handled correctly.
+ */
+json_key make_json_key(const char* tag);
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_KEY_H
@@ -0,0 +1,39 @@
+#ifndef BOOST_ARCHIVE_JSON_MAPPED_FILE_H
+#define BOOST_ARCHIVE_JSON_MAPPED_FILE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <filesystem>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ */
+class json_mapped_file
+{
+public:
+  explicit json_mapped_file(const std::filesystem::path& path);
+
+  json_mapped_file(json_mapped_file&& other) noexcept;
+
+  json_mapped_file(const json_mapped_file&) = delete;
+
+  ~json_mapped_file();
+
+  inline const char* data() const { return data_; }
+
+  inline std::size_t size() const { return size_; }
+
+private:
+  const char* data_;
+  std::size_t size_;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_MAPPED_FILE_H
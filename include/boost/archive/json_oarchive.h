@@ -2,112 +2,118 @@
 #define BOOST_ARCHIVE_JSON_OARCHIVE_H
 
 // C++ Standard Library
-#include <iterator>
+#include <memory_resource>
+#include <optional>
 #include <ostream>
-#include <sstream>
 #include <type_traits>
 
 // Boost
-#include <boost/archive/detail/common_oarchive.hpp>
 #include <boost/archive/detail/register_archive.hpp>
 
 // Boost Archive JSON
-#include <boost/archive/picojson_wrapper.h>
-#include <boost/serialization/array.hpp>
-#include <boost/serialization/item_version_type.hpp>
-#include <boost/serialization/nvp.hpp>
+#include <boost/archive/basic_json_oarchive.h>
+#include <boost/archive/json_archive_buffers.h>
+#include <boost/archive/json_document.h>
+#include <boost/archive/json_output_buffer.h>
+#include <boost/archive/json_worker_pool.h>
 
 namespace boost
 {
 namespace archive
 {
 
-class json_oarchive : public detail::common_oarchive<json_oarchive>
+/**
+ * @brief Builds a JSON document in memory and writes it to the output stream on destruction
+ *
+ *        The document is allocated from an arena which requests memory from \p upstream, and is released all at once
+ *        when the archive is destroyed.
+ *
+ *        Archives constructed for each of many small messages can instead borrow \p json_archive_buffers, and reuse
+ *        their memory from one message to the next.
+ *
+ *        With \p json_parallel_serialize, large arrays are formatted on one thread per hardware thread, and written in
+ *        order. The threads are started with the archive, and shared by all of its arrays. The document itself is
+ *        still built one value at a time, so object tracking works as usual.
+ */
+class json_oarchive : public basic_json_oarchive<json_oarchive, json_document>
 {
 public:
-  explicit json_oarchive(std::ostream& os, const bool prettify = false);
-
-  ~json_oarchive();
-
-  inline void save_start(const char* tag) { json_.ctx_start(tag); }
-
-  inline void save_end(const char* tag) { json_.ctx_end(tag); }
-
-  template <typename T> void save_override(const boost::serialization::nvp<T>& kv)
+  /**
+   * @param flags  <code>boost::archive::archive_flags</code> and \p json_archive_flags
+   */
+  explicit json_oarchive(
+    std::ostream& os,
+    const bool prettify = false,
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+    const unsigned int flags = 0);
+
+  /**
+   * @brief Writes to any \p sink with a <code>write(const char* data, std::size_t size)</code> member
+   */
+  template <typename SinkT, typename = std::enable_if_t<!std::is_base_of<std::ostream, SinkT>::value>>
+  explicit json_oarchive(
+    SinkT& sink,
+    const bool prettify = false,
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+    const unsigned int flags = 0) :
+      basic_json_oarchive<json_oarchive, json_document>{flags, upstream},
+      out_{sink},
+      prettify_{prettify}
   {
-    try
-    {
-      json_.ctx_start(kv.name());
-      json_.object_start();
-      this->save(kv.const_value());
-      json_.object_end();
-      json_.ctx_end(kv.name());
-    }
-    catch (const std::runtime_error& err)
-    {
-      std::ostringstream oss;
-      oss << '[' << kv.name() << "] : " << err.what();
-      throw json_archive_exception{oss.str()};
-    }
-    // ctx_start --> std::logic_error intentionally not caught
+    start_workers();
   }
 
-  template <typename T>
-  std::enable_if_t<fusion::result_of::has_key<meta_type_conversions, T>::type::value> save_override(const T& value)
+  /**
+   * @brief Allocates from the default resource, taking \p flags in the same position as \p json_stream_oarchive
+   */
+  json_oarchive(std::ostream& os, const bool prettify, const unsigned int flags);
+
+  /**
+   * @brief Writes to any \p sink, taking \p flags in the same position as \p json_stream_oarchive
+   */
+  template <typename SinkT, typename = std::enable_if_t<!std::is_base_of<std::ostream, SinkT>::value>>
+  json_oarchive(SinkT& sink, const bool prettify, const unsigned int flags) :
+      json_oarchive{sink, prettify, std::pmr::get_default_resource(), flags}
+  {}
+
+  /**
+   * @brief Borrows \p buffers, which must outlive the archive, in place of allocating its own memory
+   */
+  json_oarchive(
+    std::ostream& os,
+    json_archive_buffers& buffers,
+    const bool prettify = false,
+    const unsigned int flags = 0);
+
+  /**
+   * @brief Writes to any \p sink, borrowing \p buffers, which must outlive the archive
+   */
+  template <typename SinkT, typename = std::enable_if_t<!std::is_base_of<std::ostream, SinkT>::value>>
+  json_oarchive(SinkT& sink, json_archive_buffers& buffers, const bool prettify = false, const unsigned int flags = 0) :
+      basic_json_oarchive<json_oarchive, json_document>{flags, buffers.resource()},
+      out_{sink, buffers.output_block()},
+      prettify_{prettify}
   {
-    save(value);
+    start_workers();
   }
 
-  template <typename T>
-  std::enable_if_t<!fusion::result_of::has_key<meta_type_conversions, T>::type::value> save_override(T& value)
-  {
-    detail::common_oarchive<json_oarchive>::save_override(value);
-  }
+  ~json_oarchive();
 
-  template <typename T> void save(const T& value)
+private:
+  /**
+   * @brief Starts the workers which format large arrays, with \p json_parallel_serialize
+   */
+  inline void start_workers()
   {
-    if constexpr (fusion::result_of::has_key<picojson_native_types, T>::type::value)
-    {
-      json_.active() = picojson::value{value};
-    }
-    else if constexpr (fusion::result_of::has_key<picojson_conversions, T>::type::value)
-    {
-      using cast_type = typename fusion::result_of::value_at_key<picojson_conversions, T>::type;
-      json_.active() = picojson::value{static_cast<cast_type>(value)};
-    }
-    else if constexpr (fusion::result_of::has_key<meta_type_conversions, T>::type::value)
+    if (this->get_flags() & json_parallel_serialize)
     {
-      using cast_type = typename fusion::result_of::value_at_key<meta_type_conversions, T>::type;
-      auto cast_value = static_cast<cast_type>(value);
-      save_override(boost::serialization::make_nvp(fusion::at_key<T>(meta_type_names), cast_value));
-    }
-    else if constexpr (detail::is_std_vector<T>::value or detail::is_fixed_size_array<T>::value)
-    {
-      json_.array_start(std::distance(std::begin(value), std::end(value)));
-
-      for (const auto& element : value)
-      {
-        json_.array_push();
-        if constexpr (!detail::is_element_native_convertible<T>::value)
-        {
-          json_.object_start();
-        }
-        this->save(element);
-        json_.object_end();
-      }
-
-      json_.array_end();
-    }
-    else
-    {
-      detail::common_oarchive<json_oarchive>::save_override(value);
+      workers_.emplace();
     }
   }
 
-private:
-  picojson_wrapper json_;
-  std::ostream* os_;
+  json_output_buffer out_;
   bool prettify_;
+  std::optional<json_worker_pool> workers_;
 };
 
 }  // archive
@@ -115,4 +121,4 @@ private:
 
 BOOST_SERIALIZATION_REGISTER_ARCHIVE(boost::archive::json_oarchive)
 
-#endif  // BOOST_ARCHIVE_JSON_IARCHIVE_H
+#endif  // BOOST_ARCHIVE_JSON_OARCHIVE_H
@@ -0,0 +1,96 @@
+#ifndef BOOST_ARCHIVE_JSON_OBJECT_SCHEMA_H
+#define BOOST_ARCHIVE_JSON_OBJECT_SCHEMA_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Member names of the first object saved for one type, in the order they were saved
+ *
+ *        Objects of the same type usually have the same members, so later objects are built by appending each member
+ *        found in the schema, without first looking for an existing member of the same name. Members which are not
+ *        found fall back to a full lookup. Names are recorded only if they were unique, so appended members are too.
+ *
+ *        Each schema may only be used from one thread.
+ */
+class json_object_schema
+{
+public:
+  enum class state
+  {
+    empty,  ///< not yet recorded
+    recording,  ///< being recorded from the first object; other objects of the type are built without it
+    complete,
+    invalid  ///< first object had repeated names, and is never used
+  };
+
+  json_object_schema() = default;
+
+  json_object_schema(const json_object_schema&) = delete;
+
+  ~json_object_schema() = default;
+
+  inline state status() const { return status_; }
+
+  inline std::size_t size() const { return names_.size(); }
+
+  /**
+   * @brief Starts recording, if the schema is empty
+   *
+   * @return <code>true</code> if recording was started
+   */
+  inline bool start()
+  {
+    if (status_ != state::empty)
+    {
+      return false;
+    }
+    status_ = state::recording;
+    return true;
+  }
+
+  /**
+   * @brief Records \p tag as the next member name
+   */
+  inline void record(const char* tag) { names_.emplace_back(tag); }
+
+  inline void finish() { status_ = state::complete; }
+
+  inline void invalidate()
+  {
+    status_ = state::invalid;
+    std::vector<std::string>{}.swap(names_);
+  }
+
+  /**
+   * @brief Returns the position of the member named \p tag at or after \p first, or \p size() if there is none
+   */
+  inline std::size_t find(const char* tag, std::size_t first) const
+  {
+    for (; first < names_.size(); ++first)
+    {
+      if (std::strcmp(names_[first].c_str(), tag) == 0)
+      {
+        return first;
+      }
+    }
+    return first;
+  }
+
+private:
+  state status_ = state::empty;
+  std::vector<std::string> names_;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_OBJECT_SCHEMA_H
@@ -0,0 +1,138 @@
+#ifndef BOOST_ARCHIVE_JSON_OUTPUT_BUFFER_H
+#define BOOST_ARCHIVE_JSON_OUTPUT_BUFFER_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Collects output characters in a contiguous block, which is handed to a sink whenever it fills up
+ *
+ *        A sink is any object with a <code>write(const char* data, std::size_t size)</code> member, which
+ *        includes <code>std::ostream</code>.
+ */
+class json_output_buffer
+{
+public:
+  static constexpr std::size_t default_capacity = 1 << 16;
+
+  /**
+   * @brief Output iterator which appends to a json_output_buffer
+   */
+  class iterator
+  {
+  public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    explicit iterator(json_output_buffer& buffer) : buffer_{std::addressof(buffer)} {}
+
+    inline iterator& operator=(const char c)
+    {
+      buffer_->put(c);
+      return *this;
+    }
+
+    inline iterator& operator*() { return *this; }
+
+    inline iterator& operator++() { return *this; }
+
+    inline iterator& operator++(int) { return *this; }
+
+  private:
+    json_output_buffer* buffer_;
+  };
+
+  template <typename SinkT>
+  explicit json_output_buffer(SinkT& sink, const std::size_t capacity = default_capacity) :
+      block_(capacity),
+      pos_{block_.data()},
+      end_{block_.data() + block_.size()},
+      sink_{std::addressof(sink)},
+      sink_write_{[](void* sink, const char* data, const std::size_t size) {
+        static_cast<SinkT*>(sink)->write(data, size);
+      }}
+  {}
+
+  /**
+   * @brief Collects output in \p block, which is grown to \p capacity if it is smaller, and handed back on destruction
+   */
+  template <typename SinkT>
+  json_output_buffer(SinkT& sink, std::vector<char>& block, const std::size_t capacity = default_capacity) :
+      json_output_buffer{sink, 0}
+  {
+    block_.swap(block);
+    if (block_.size() < capacity)
+    {
+      block_.resize(capacity);
+    }
+    pos_ = block_.data();
+    end_ = block_.data() + block_.size();
+    lender_ = std::addressof(block);
+  }
+
+  json_output_buffer(const json_output_buffer&) = delete;
+
+  ~json_output_buffer()
+  {
+    if (lender_ != nullptr)
+    {
+      lender_->swap(block_);
+    }
+  }
+
+  inline void put(const char c)
+  {
+    if (pos_ == end_)
+    {
+      flush();
+    }
+    *pos_++ = c;
+  }
+
+  inline void write(const char* data, const std::size_t size)
+  {
+    if (size <= static_cast<std::size_t>(end_ - pos_))
+    {
+      std::memcpy(pos_, data, size);
+      pos_ += size;
+    }
+    else
+    {
+      write_through(data, size);
+    }
+  }
+
+  inline iterator output_iterator() { return iterator{*this}; }
+
+  /**
+   * @brief Hands all buffered characters to the sink
+   */
+  void flush();
+
+private:
+  void write_through(const char* data, const std::size_t size);
+
+  std::vector<char> block_;
+  char* pos_;
+  char* end_;
+  void* sink_;
+  void (*sink_write_)(void*, const char*, std::size_t);
+  std::vector<char>* lender_ = nullptr;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_OUTPUT_BUFFER_H
@@ -0,0 +1,53 @@
+#ifndef BOOST_ARCHIVE_JSON_STREAM_IARCHIVE_H
+#define BOOST_ARCHIVE_JSON_STREAM_IARCHIVE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+
+// Boost
+#include <boost/archive/detail/register_archive.hpp>
+
+// Boost Archive JSON
+#include <boost/archive/basic_json_iarchive.h>
+#include <boost/archive/json_stream_reader.h>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Reads JSON from the input stream incrementally, as values are loaded
+ *
+ *        Members which are loaded in the same order as they appear in the input are read directly from the stream.
+ *        Members which appear before the one being loaded are buffered until they are requested, and members which are
+ *        never loaded are skipped.
+ */
+class json_stream_iarchive : public basic_json_iarchive<json_stream_iarchive, json_stream_reader>
+{
+public:
+  explicit json_stream_iarchive(std::istream& is);
+
+  /**
+   * @brief Reads directly from \p size characters at \p data, which must outlive the archive
+   */
+  json_stream_iarchive(const char* data, const std::size_t size);
+
+  /**
+   * @brief Memory-maps the file at \p path, which stays mapped for the lifetime of the archive
+   *
+   *        Keys and strings without escape sequences are read straight out of the mapping.
+   */
+  explicit json_stream_iarchive(const std::filesystem::path& path);
+
+  ~json_stream_iarchive() = default;
+};
+
+}  // archive
+}  // boost
+
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(boost::archive::json_stream_iarchive)
+
+#endif  // BOOST_ARCHIVE_JSON_STREAM_IARCHIVE_H
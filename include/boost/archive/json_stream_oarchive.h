@@ -0,0 +1,50 @@
+#ifndef BOOST_ARCHIVE_JSON_STREAM_OARCHIVE_H
+#define BOOST_ARCHIVE_JSON_STREAM_OARCHIVE_H
+
+// C++ Standard Library
+#include <ostream>
+#include <type_traits>
+
+// Boost
+#include <boost/archive/detail/register_archive.hpp>
+
+// Boost Archive JSON
+#include <boost/archive/basic_json_oarchive.h>
+#include <boost/archive/json_stream_writer.h>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Writes JSON to the output stream while serializing, without building a document in memory
+ *
+ *        Memory use is proportional to nesting depth. Object members are written in serialization order.
+ *        The root object is closed on destruction.
+ */
+class json_stream_oarchive : public basic_json_oarchive<json_stream_oarchive, json_stream_writer>
+{
+public:
+  /**
+   * @param flags  <code>boost::archive::archive_flags</code> and \p json_archive_flags
+   */
+  explicit json_stream_oarchive(std::ostream& os, const bool prettify = false, const unsigned int flags = 0);
+
+  /**
+   * @brief Writes to any \p sink with a <code>write(const char* data, std::size_t size)</code> member
+   */
+  template <typename SinkT, typename = std::enable_if_t<!std::is_base_of<std::ostream, SinkT>::value>>
+  explicit json_stream_oarchive(SinkT& sink, const bool prettify = false, const unsigned int flags = 0) :
+      basic_json_oarchive<json_stream_oarchive, json_stream_writer>{flags, sink, prettify}
+  {}
+
+  ~json_stream_oarchive();
+};
+
+}  // archive
+}  // boost
+
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(boost::archive::json_stream_oarchive)
+
+#endif  // BOOST_ARCHIVE_JSON_STREAM_OARCHIVE_H
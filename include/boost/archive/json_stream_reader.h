@@ -0,0 +1,229 @@
+#ifndef BOOST_ARCHIVE_JSON_STREAM_READER_H
+#define BOOST_ARCHIVE_JSON_STREAM_READER_H
+
+// C++ Standard Library
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Boost Archive JSON
+#include <boost/archive/json_document.h>
+#include <boost/archive/json_mapped_file.h>
+#include <boost/archive/json_tokenizer.h>
+#include <boost/archive/json_value.h>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Reads JSON values from an input stream on demand, as they are requested by an input archive
+ *
+ *        Mirrors the input-side interface of \p json_document. Input is read in fixed-size chunks (or directly
+ *        from a contiguous buffer) and tokenized incrementally, so only the values which are requested out of order
+ *        (i.e. members which appear in the input before the member being looked up) are ever parsed into a
+ *        \p json_value tree. Members which are never requested are skipped without being parsed.
+ */
+class json_stream_reader
+{
+public:
+  explicit json_stream_reader(std::istream& is);
+
+  /**
+   * @brief Reads directly from \p size characters at \p data, which must outlive the reader
+   */
+  json_stream_reader(const char* data, const std::size_t size);
+
+  /**
+   * @brief Reads directly from a mapped \p file, which is kept mapped for the lifetime of the reader
+   */
+  explicit json_stream_reader(json_mapped_file file);
+
+  ~json_stream_reader();
+
+  /**
+   * @brief Makes the member named \p tag active, buffering any members which precede it
+   *
+   * @return <code>false</code> if the active object has no such member
+   */
+  bool ctx_find(const char* tag);
+
+  /**
+   * @brief Makes the member named \p tag active only if it is the next member of the active object
+   *
+   *        The next member is read up to its value, and is returned by the next lookup if it has another name, so
+   *        that optional members which are always saved first (i.e. archive metadata) are never looked for further
+   *        into the object.
+   */
+  bool ctx_find_next(const char* tag);
+
+  void ctx_end(const char* tag);
+
+  template <typename T> T get();
+
+  std::size_t array_size();
+
+  std::size_t object_size();
+
+  template <typename ElementLoaderT> void array_for_each(ElementLoaderT&& load_element)
+  {
+    if (frames_.back().state == frame_state::buffered)
+    {
+      frames_.back().buffered->array_for_each(std::forward<ElementLoaderT>(load_element));
+      return;
+    }
+
+    array_start();
+    while (array_next())
+    {
+      load_element();
+      close_value();
+    }
+  }
+
+  /**
+   * @brief Makes each member of the active object active in turn, as it is read, passing its name to \p load_member
+   *
+   *        The name is only valid until the member value is loaded.
+   */
+  template <typename MemberLoaderT> void object_for_each(MemberLoaderT&& load_member)
+  {
+    if (frames_.back().state == frame_state::buffered)
+    {
+      frames_.back().buffered->object_for_each(std::forward<MemberLoaderT>(load_member));
+      return;
+    }
+
+    object_start();
+    std::string_view key;
+    while (next_member(frames_.back(), key))
+    {
+      frames_.push_back(frame{frame_state::value, false, false, 0, {}, nullptr});
+      load_member(key);
+      close_value();
+    }
+    frames_.back().state = frame_state::closed;
+  }
+
+  /**
+   * @brief Passes each element of the active array to \p store as a \p JsonNumberT, as it is read
+   */
+  template <typename JsonNumberT, typename StoreT> void array_for_each_number(StoreT&& store)
+  {
+    if (frames_.back().state == frame_state::buffered)
+    {
+      frames_.back().buffered->template array_for_each_number<JsonNumberT>(std::forward<StoreT>(store));
+      return;
+    }
+
+    array_start();
+    while (next_element(frames_.back()))
+    {
+      store(read_number().to_number<JsonNumberT>());
+    }
+  }
+
+  /**
+   * @brief Passes each element of the active array to \p store as a <code>bool</code>, as it is read
+   */
+  template <typename StoreT> void array_for_each_bool(StoreT&& store)
+  {
+    if (frames_.back().state == frame_state::buffered)
+    {
+      frames_.back().buffered->array_for_each_bool(std::forward<StoreT>(store));
+      return;
+    }
+
+    array_start();
+    in_.read_bool_elements(std::forward<StoreT>(store));
+    frames_.back().state = frame_state::closed;
+    frames_.back().open = false;
+  }
+
+  bool is_object();
+
+  bool is_null();
+
+  /**
+   * @brief Skips whatever was not loaded from the current root value, and starts reading the next one
+   *
+   *        The first call starts reading the first root value.
+   *
+   * @return <code>false</code> if the input has no more values
+   */
+  bool next_record();
+
+private:
+  enum class frame_state : std::uint8_t
+  {
+    value,  ///< value has not been read from the input yet
+    object,
+    array,
+    closed,  ///< value has been fully read from the input
+    buffered  ///< value was read out of order, and is loaded from \p frame::buffered
+  };
+
+  struct frame
+  {
+    frame_state state;
+    bool open;  ///< closing bracket of an object/array has not been read yet
+    bool first;  ///< no member/element of an object/array has been read yet
+    std::size_t depth;  ///< number of open contexts within a buffered value
+    std::map<std::string, json_value, std::less<>> skipped;  ///< members which were read before they were requested
+    std::unique_ptr<json_document> buffered;
+    bool peeked = false;  ///< name of the next member was read by \p ctx_find_next, and is kept in \p peeked_key
+    std::string peeked_key = {};
+  };
+
+  /**
+   * @brief Makes the member named \p tag active, reading past other members only if \p scan is set
+   */
+  bool find_member(const char* tag, const bool scan);
+
+  void array_start();
+
+  bool array_next();
+
+  void object_start();
+
+  bool next_element(frame& ctx);
+
+  bool next_member(frame& ctx, std::string_view& key);
+
+  void close_value();
+
+  frame& value_frame(const char* expected);
+
+  template <typename NumberT> NumberT get_number();
+
+  const json_value& read_number();
+
+  std::vector<frame> frames_;
+  json_tokenizer in_;
+  std::string key_;
+  json_value number_;
+  bool record_started_ = false;
+};
+
+template <> bool json_stream_reader::get<bool>();
+
+template <> std::int64_t json_stream_reader::get<std::int64_t>();
+
+template <> std::uint64_t json_stream_reader::get<std::uint64_t>();
+
+template <> float json_stream_reader::get<float>();
+
+template <> double json_stream_reader::get<double>();
+
+template <> std::string json_stream_reader::get<std::string>();
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_STREAM_READER_H
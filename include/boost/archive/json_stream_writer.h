@@ -0,0 +1,189 @@
+#ifndef BOOST_ARCHIVE_JSON_STREAM_WRITER_H
+#define BOOST_ARCHIVE_JSON_STREAM_WRITER_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Boost Archive JSON
+#include <boost/archive/json_format.h>
+#include <boost/archive/json_object_schema.h>
+#include <boost/archive/json_output_buffer.h>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Writes JSON tokens to an output stream as soon as they are known
+ *
+ *        Mirrors the output-side interface of \p json_document, but keeps only one small frame per open
+ *        object/array instead of a document tree. Output is identical to a compact (or prettified) serialization
+ *        of the same \p json_document.
+ *
+ *        Output is handed to the sink in blocks, and whenever a top-level member is complete (or, with
+ *        \p flush_records, only whenever a record is complete).
+ */
+class json_stream_writer
+{
+public:
+  /**
+   * @param flush_records  hand output to the sink on \p end_record instead of after each top-level member
+   */
+  template <typename SinkT>
+  explicit json_stream_writer(SinkT& sink, const bool prettify = false, const bool flush_records = false) :
+      frames_{frame{frame_state::object_pending, 0}},
+      out_{sink},
+      prettify_{prettify},
+      flush_records_{flush_records}
+  {}
+
+  ~json_stream_writer() = default;
+
+  void ctx_start(const char* tag);
+
+  /**
+   * @brief Starts a member named \p key, which is only known at runtime, and is escaped each time it is written
+   */
+  void ctx_start_key(const std::string_view key);
+
+  void ctx_end(const char* tag);
+
+  void object_start();
+
+  /**
+   * @brief Starts an object; members are written as they are started, so \p schema is not needed
+   */
+  inline void object_start(json_object_schema& schema) { object_start(); }
+
+  inline void object_start(const std::size_t reserve) { object_start(); }
+
+  constexpr void object_end() const {}
+
+  void array_start(const std::size_t reserve);
+
+  void array_end();
+
+  void array_push();
+
+  void put(const bool value);
+
+  void put(const std::int64_t value);
+
+  void put(const std::uint64_t value);
+
+  void put(const float value);
+
+  void put(const double value);
+
+  void put(const std::string& value);
+
+  void put_null();
+
+  /**
+   * @brief Writes an array of \p size numbers at \p values, each converted to \p JsonNumberT
+   */
+  template <typename JsonNumberT, typename NumberT> void put_array(const NumberT* values, const std::size_t size)
+  {
+    array_start(size);
+    auto& ctx = frames_.back();
+    for (std::size_t n = 0; n < size; ++n)
+    {
+      write_separator(ctx);
+      write_json_number(out_, static_cast<JsonNumberT>(values[n]));
+    }
+    array_end();
+  }
+
+  /**
+   * @brief Writes an array of the \p size booleans <code>bits[0]</code> to <code>bits[size - 1]</code>
+   */
+  template <typename BitsT> void put_bool_array(const BitsT& bits, const std::size_t size)
+  {
+    array_start(size);
+    auto& ctx = frames_.back();
+    for (std::size_t n = 0; n < size; ++n)
+    {
+      write_separator(ctx);
+      if (bits[n])
+      {
+        out_.write("true", 4);
+      }
+      else
+      {
+        out_.write("false", 5);
+      }
+    }
+    array_end();
+  }
+
+  /**
+   * @brief Closes all open values, including the root object
+   */
+  void finish();
+
+  /**
+   * @brief Closes the root object and ends the line, if any member was written to it, then starts a new root object
+   *
+   *        Must only be called between top-level members.
+   */
+  void end_record();
+
+  /**
+   * @brief Closes any values left open within the current record, as \p finish does, then ends the record
+   *
+   *        Used when a record may have been left incomplete, e.g. by a save which threw.
+   */
+  void finish_record();
+
+  /**
+   * @brief Returns <code>true</code> between top-level members
+   */
+  inline bool at_root() const { return frames_.size() == 1; }
+
+private:
+  enum class frame_state : std::uint8_t
+  {
+    value,  ///< nothing written yet
+    object_pending,  ///< value is an object, but '{' is only written with its first member
+    object,
+    array,
+    closed
+  };
+
+  struct frame
+  {
+    frame_state state;
+    std::size_t count;
+  };
+
+  /**
+   * @brief Opens the active object, if needed, and writes the separator preceding its next member
+   */
+  void member_start();
+
+  /**
+   * @brief Pushes the frame of a member value, once its name has been written
+   */
+  void member_value_start();
+
+  void close_value();
+
+  void write_separator(frame& container);
+
+  frame& value_frame();
+
+  std::vector<frame> frames_;
+  json_output_buffer out_;
+  bool prettify_;
+  bool flush_records_;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_STREAM_WRITER_H
@@ -0,0 +1,127 @@
+#ifndef BOOST_ARCHIVE_JSON_STRING_SCAN_H
+#define BOOST_ARCHIVE_JSON_STRING_SCAN_H
+
+// C++ Standard Library
+#include <cstddef>
+
+namespace boost
+{
+namespace archive
+{
+namespace detail
+{
+
+/**
+ * @brief Number of characters scanned inline before handing over to the vectorized scanners
+ *
+ *        Runs between escaped characters, and keys, are often short enough that dispatching costs more than it saves.
+ */
+constexpr std::ptrdiff_t inline_scan_size = 16;
+
+/**
+ * @brief Character classes used by the inline scanners, as one lookup per character
+ */
+struct json_char_class_table
+{
+  static constexpr unsigned char escaped = 1;
+  static constexpr unsigned char special = 2;
+  static constexpr unsigned char nesting = 4;
+
+  unsigned char values[256];
+
+  constexpr json_char_class_table() : values{}
+  {
+    for (int c = 0; c < 0x20; ++c)
+    {
+      values[c] = escaped;
+    }
+    values[0x7f] = escaped;
+    values[static_cast<unsigned char>('/')] = escaped;
+    values[static_cast<unsigned char>('"')] = escaped | special | nesting;
+    values[static_cast<unsigned char>('\\')] = escaped | special;
+    values[static_cast<unsigned char>('{')] = nesting;
+    values[static_cast<unsigned char>('}')] = nesting;
+    values[static_cast<unsigned char>('[')] = nesting;
+    values[static_cast<unsigned char>(']')] = nesting;
+  }
+};
+
+inline constexpr json_char_class_table json_char_classes{};
+
+inline bool is_json_escaped_char(const char c)
+{
+  return json_char_classes.values[static_cast<unsigned char>(c)] & json_char_class_table::escaped;
+}
+
+inline bool is_json_string_special(const char c)
+{
+  return json_char_classes.values[static_cast<unsigned char>(c)] & json_char_class_table::special;
+}
+
+inline bool is_json_nesting_char(const char c)
+{
+  return json_char_classes.values[static_cast<unsigned char>(c)] & json_char_class_table::nesting;
+}
+
+const char* find_json_escaped_char_block(const char* first, const char* last);
+
+const char* find_json_string_special_block(const char* first, const char* last);
+
+const char* find_json_nesting_char_block(const char* first, const char* last);
+
+}  // namespace detail
+
+/**
+ * @brief Returns the first character in [\p first, \p last) which must be escaped in a JSON string, or \p last
+ *
+ *        Escaped characters are quotes, backslashes, forward slashes, control characters and DEL.
+ */
+inline const char* find_json_escaped_char(const char* first, const char* last)
+{
+  const char* const inline_last = (last - first > detail::inline_scan_size) ? first + detail::inline_scan_size : last;
+  for (; first != inline_last; ++first)
+  {
+    if (detail::is_json_escaped_char(*first))
+    {
+      return first;
+    }
+  }
+  return (first == last) ? last : detail::find_json_escaped_char_block(first, last);
+}
+
+/**
+ * @brief Returns the first quote or backslash in [\p first, \p last), or \p last
+ */
+inline const char* find_json_string_special(const char* first, const char* last)
+{
+  const char* const inline_last = (last - first > detail::inline_scan_size) ? first + detail::inline_scan_size : last;
+  for (; first != inline_last; ++first)
+  {
+    if (detail::is_json_string_special(*first))
+    {
+      return first;
+    }
+  }
+  return (first == last) ? last : detail::find_json_string_special_block(first, last);
+}
+
+/**
+ * @brief Returns the first quote or bracket in [\p first, \p last), or \p last
+ */
+inline const char* find_json_nesting_char(const char* first, const char* last)
+{
+  const char* const inline_last = (last - first > detail::inline_scan_size) ? first + detail::inline_scan_size : last;
+  for (; first != inline_last; ++first)
+  {
+    if (detail::is_json_nesting_char(*first))
+    {
+      return first;
+    }
+  }
+  return (first == last) ? last : detail::find_json_nesting_char_block(first, last);
+}
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_STRING_SCAN_H
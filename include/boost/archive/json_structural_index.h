@@ -0,0 +1,46 @@
+#ifndef BOOST_ARCHIVE_JSON_STRUCTURAL_INDEX_H
+#define BOOST_ARCHIVE_JSON_STRUCTURAL_INDEX_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Offsets of every token in a JSON text, found in one vectorized pass over the input
+ *
+ *        Tokens are the structural characters <code>{}[]:,</code> and opening quotes outside of strings, and the
+ *        first character of every number and literal. Escaped quotes are handled, so the contents of strings never
+ *        appear in the index. The input is not validated; malformed input is detected when it is parsed.
+ */
+class json_structural_index
+{
+public:
+  /// Inputs must be smaller than this to be indexed, since offsets are stored in 32 bits
+  static constexpr std::size_t max_size = std::numeric_limits<std::uint32_t>::max();
+
+  /**
+   * @brief Indexes \p size characters at \p data
+   */
+  json_structural_index(const char* data, const std::size_t size);
+
+  inline const std::uint32_t* begin() const { return offsets_.data(); }
+
+  inline const std::uint32_t* end() const { return offsets_.data() + offsets_.size(); }
+
+  inline std::size_t size() const { return offsets_.size(); }
+
+private:
+  std::vector<std::uint32_t> offsets_;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_STRUCTURAL_INDEX_H
@@ -0,0 +1,239 @@
+#ifndef BOOST_ARCHIVE_JSON_TOKENIZER_H
+#define BOOST_ARCHIVE_JSON_TOKENIZER_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Boost Archive JSON
+#include <boost/archive/json_mapped_file.h>
+#include <boost/archive/json_structural_index.h>
+#include <boost/archive/json_value.h>
+#include <boost/archive/json_worker_pool.h>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Reads JSON tokens from an input stream, a contiguous buffer or a mapped file
+ *
+ *        Stream input is read in fixed-size chunks. Errors are reported as <code>std::runtime_error</code> with the
+ *        offset into the input at which they were detected.
+ */
+class json_tokenizer
+{
+public:
+  explicit json_tokenizer(std::istream& is);
+
+  /**
+   * @brief Reads directly from \p size characters at \p data, which must outlive the tokenizer
+   *
+   *        Errors are reported at offsets from \p offset, for \p data which is part of a larger input.
+   */
+  json_tokenizer(const char* data, const std::size_t size, const std::size_t offset = 0);
+
+  /**
+   * @brief Reads directly from a mapped \p file, which is kept mapped for the lifetime of the tokenizer
+   */
+  explicit json_tokenizer(json_mapped_file file);
+
+  /**
+   * @brief Returns the next non-whitespace character without consuming it, or <code>EOF</code>
+   */
+  int peek_token();
+
+  /**
+   * @brief Consumes and returns the next character, or <code>EOF</code>
+   */
+  int next_char();
+
+  /**
+   * @brief Consumes the character returned by the last call to \p peek_token
+   */
+  inline void advance() { ++pos_; }
+
+  void expect(const char c);
+
+  /**
+   * @brief Reads a string token, appending its unescaped contents to \p out, if not <code>nullptr</code>
+   */
+  void read_string(std::string* out);
+
+  /**
+   * @brief Reads a string token, referring to the input directly where possible, and to \p scratch otherwise
+   *
+   *        Input read from a stream may be overwritten by the next chunk, so the string is only valid until more input
+   *        is read, unless \p reads_chunks is <code>false</code>.
+   */
+  std::string_view read_string_view(std::string& scratch);
+
+  /**
+   * @brief Returns <code>true</code> if input is read from a stream, into a buffer which is reused for each chunk
+   */
+  inline bool reads_chunks() const { return is_ != nullptr; }
+
+  /**
+   * @brief Reads a number token into \p out
+   *
+   *        Integers are stored as <code>std::int64_t</code>, or as <code>std::uint64_t</code> if they are too large
+   *        for a signed representation. All other numbers are stored as the nearest <code>double</code>.
+   */
+  void read_number(json_value& out);
+
+  void read_literal(const char* literal);
+
+  /**
+   * @brief Reads a <code>true</code> or <code>false</code> token
+   */
+  bool read_bool();
+
+  /**
+   * @brief Reads the elements of an array of booleans, following its opening bracket, through its closing bracket,
+   *        passing each to \p store
+   *
+   *        Compact elements are matched directly in the input; whitespace and chunk boundaries fall back to reading
+   *        one token at a time.
+   */
+  template <typename StoreT> void read_bool_elements(StoreT&& store)
+  {
+    if (peek_token() == ']')
+    {
+      ++pos_;
+      return;
+    }
+
+    while (true)
+    {
+      if (end_ - pos_ >= 4 and std::memcmp(pos_, "true", 4) == 0)
+      {
+        pos_ += 4;
+        store(true);
+      }
+      else if (end_ - pos_ >= 5 and std::memcmp(pos_, "false", 5) == 0)
+      {
+        pos_ += 5;
+        store(false);
+      }
+      else
+      {
+        store(read_bool());
+      }
+
+      if (pos_ != end_ and *pos_ == ',')
+      {
+        ++pos_;
+      }
+      else if (peek_token() == ']')
+      {
+        ++pos_;
+        return;
+      }
+      else
+      {
+        expect(',');
+      }
+    }
+  }
+
+  /**
+   * @brief Parses a whole value into \p out, allocating strings, arrays and objects from \p resource
+   */
+  void parse_value(json_value& out, std::pmr::memory_resource* resource);
+
+  /**
+   * @brief Parses a whole value into \p out like \p parse_value, jumping between the tokens found by \p index
+   *        instead of reading the input one character at a time
+   *
+   *        \p index must have been built over the same input as the tokenizer, which must be read from memory.
+   */
+  void parse_value(json_value& out, std::pmr::memory_resource* resource, const json_structural_index& index);
+
+  /**
+   * @brief Parses a whole value into \p out like \p parse_value, but only one level deep
+   *
+   *        Objects and arrays nested in the value are skipped by matching brackets, and kept as
+   *        \p json_value::deferred text which refers to the input. The input must be read from memory.
+   */
+  void parse_shallow_value(json_value& out, std::pmr::memory_resource* resource);
+
+  /**
+   * @brief Parses a whole value into \p out like \p parse_value, splitting large arrays which are members of an
+   *        outermost object between one thread per resource in \p thread_resources
+   *
+   *        Array elements are first found by matching brackets. Each thread of \p workers then parses a contiguous
+   *        run of elements into their slots in the array, allocating from its own resource. There must be no more
+   *        resources than \p workers has threads. The input must be read from memory.
+   */
+  void parse_parallel_value(
+    json_value& out,
+    std::pmr::memory_resource* resource,
+    const std::vector<std::pmr::memory_resource*>& thread_resources,
+    json_worker_pool& workers);
+
+  /**
+   * @brief Skips a whole value, matching brackets without validating contents
+   *
+   *        Input read from memory in which brackets do not match is parsed instead, from the start of the value, so
+   *        that errors are reported as \p parse_value would.
+   */
+  void skip_value();
+
+  [[noreturn]] void error(const char* what) const;
+
+private:
+  bool fill();
+
+  /**
+   * @brief Reports an error found while skipping the value at \p first
+   */
+  [[noreturn]] void skip_error(const char* first, const char* what);
+
+  /**
+   * @brief Parses a value, deferring objects and arrays nested more than \p depth levels into it
+   */
+  void parse_value(json_value& out, std::pmr::memory_resource* resource, const std::size_t depth);
+
+  void parse_parallel_array(
+    json_value& out,
+    std::pmr::memory_resource* resource,
+    const std::vector<std::pmr::memory_resource*>& thread_resources,
+    json_worker_pool& workers);
+
+  /**
+   * @brief Moves to the next indexed token and returns its first character, or <code>EOF</code> after the last one
+   */
+  int next_token(const std::uint32_t*& token, const std::uint32_t* last);
+
+  void parse_indexed_value(
+    json_value& out,
+    std::pmr::memory_resource* resource,
+    const std::uint32_t*& token,
+    const std::uint32_t* last);
+
+  std::istream* is_;
+  std::optional<json_mapped_file> file_;
+  std::vector<char> buffer_;
+  const char* begin_;
+  const char* pos_;
+  const char* end_;
+  std::size_t offset_;
+  std::string scratch_;
+  std::string number_;
+
+  /// Closing brackets expected by \p skip_value, innermost last
+  std::string closers_;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_TOKENIZER_H
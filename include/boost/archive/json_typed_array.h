@@ -0,0 +1,66 @@
+#ifndef BOOST_ARCHIVE_JSON_TYPED_ARRAY_H
+#define BOOST_ARCHIVE_JSON_TYPED_ARRAY_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Returns the NumPy-style type string (e.g. <code>"<f4"</code>) of elements with the given \p kind
+ *        (<code>'i'</code>, <code>'u'</code> or <code>'f'</code>) and \p size, in host byte order
+ */
+std::string typed_array_dtype(const char kind, const std::size_t size);
+
+template <typename T> inline std::string typed_array_dtype()
+{
+  static_assert(std::is_arithmetic<T>::value, "Typed array elements must be arithmetic");
+  return typed_array_dtype(std::is_floating_point<T>::value ? 'f' : std::is_signed<T>::value ? 'i' : 'u', sizeof(T));
+}
+
+/**
+ * @brief Checks that \p dtype describes elements with the given \p kind and \p size, in any byte order; throws
+ *        <code>std::runtime_error</code> if it does not
+ *
+ * @return <code>true</code> if elements are stored in the opposite of the host byte order
+ */
+bool typed_array_dtype_swapped(const std::string_view dtype, const char kind, const std::size_t size);
+
+template <typename T> inline bool typed_array_dtype_swapped(const std::string_view dtype)
+{
+  return typed_array_dtype_swapped(
+    dtype, std::is_floating_point<T>::value ? 'f' : std::is_signed<T>::value ? 'i' : 'u', sizeof(T));
+}
+
+/**
+ * @brief Reverses the byte order of each of \p count elements of \p size bytes at \p data
+ */
+void byte_swap(void* data, const std::size_t count, const std::size_t size);
+
+/**
+ * @brief Returns \p size bytes at \p data, encoded as base64
+ */
+std::string encode_base64(const void* data, const std::size_t size);
+
+/**
+ * @brief Returns the number of bytes encoded by \p size base64 characters at \p data; throws
+ *        <code>std::runtime_error</code> if \p size is not a valid length for padded base64
+ */
+std::size_t base64_decoded_size(const char* data, const std::size_t size);
+
+/**
+ * @brief Decodes \p size base64 characters at \p data to \p out, which must hold \p base64_decoded_size bytes;
+ *        throws <code>std::runtime_error</code> on characters outside of the base64 alphabet
+ */
+void decode_base64(const char* data, const std::size_t size, void* out);
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_TYPED_ARRAY_H
@@ -0,0 +1,223 @@
+#ifndef BOOST_ARCHIVE_JSON_VALUE_H
+#define BOOST_ARCHIVE_JSON_VALUE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Boost Archive JSON
+#include <boost/archive/json_output_buffer.h>
+#include <boost/archive/json_worker_pool.h>
+
+namespace boost
+{
+namespace archive
+{
+
+class json_value;
+
+/**
+ * @brief JSON object, with members kept in insertion order
+ *
+ *        Members are stored contiguously. Small objects are searched linearly; objects with more than
+ *        \p hashed_lookup_threshold members also keep an open-addressing index from key hash to member position.
+ */
+class json_object
+{
+public:
+  using member = std::pair<std::pmr::string, json_value>;
+
+  static constexpr std::size_t hashed_lookup_threshold = 16;
+
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  explicit json_object(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  json_object(const json_object& other);
+
+  json_object(json_object&& other) noexcept;
+
+  ~json_object();
+
+  json_object& operator=(const json_object& other);
+
+  json_object& operator=(json_object&& other);
+
+  /**
+   * @brief Returns the position of the member named \p key, or \p npos if there is no such member
+   */
+  std::size_t position(const std::string_view key) const;
+
+  json_value* find(const std::string_view key);
+
+  const json_value* find(const std::string_view key) const;
+
+  /**
+   * @brief Returns the member named \p key, first appending it with a null value if it does not exist yet
+   *
+   * @return member value, and <code>true</code> if it was appended
+   */
+  std::pair<json_value*, bool> try_emplace(const std::string_view key);
+
+  /**
+   * @brief Appends a member named \p key with a null value, which the caller knows does not exist yet
+   *
+   *        An index is kept up to date if the object already has one, but is not built for this member alone.
+   */
+  json_value& emplace_back(const std::string_view key);
+
+  inline void reserve(const std::size_t capacity) { members_.reserve(capacity); }
+
+  inline std::size_t size() const { return members_.size(); }
+
+  inline bool empty() const { return members_.empty(); }
+
+  inline auto begin() const { return members_.begin(); }
+
+  inline auto end() const { return members_.end(); }
+
+  inline member& operator[](const std::size_t n) { return members_[n]; }
+
+  inline const member& operator[](const std::size_t n) const { return members_[n]; }
+
+private:
+  void index_insert(const std::size_t position);
+
+  void index_rebuild();
+
+  void index_release();
+
+  std::pmr::vector<member> members_;
+
+  /// Number of slots, followed by member position + 1 (or 0, if empty) per slot; allocated only for large objects
+  std::uint32_t* index_;
+};
+
+/**
+ * @brief JSON document node
+ *
+ *        Numbers keep the representation they were created (or parsed) with: signed 64-bit integers, unsigned 64-bit
+ *        integers, floats or doubles. Integers are never routed through a double, so they round-trip exactly, and
+ *        floats are written with the shortest representation which reads back as the same float.
+ *
+ *        Strings, arrays and objects allocate from the <code>std::pmr::memory_resource</code> they were created with.
+ */
+class json_value
+{
+public:
+  using null = std::nullptr_t;
+  using string = std::pmr::string;
+  using array = std::pmr::vector<json_value>;
+  using object = json_object;
+
+  /**
+   * @brief Text of an object or array which is parsed only once it is needed; see \p json_lazy_parse
+   *
+   *        The text is not owned, and is written verbatim when the value is serialized.
+   */
+  struct deferred
+  {
+    std::string_view text;
+
+    /// Offset of \p text into the whole input, from which error offsets are reported
+    std::size_t offset;
+  };
+
+  json_value() = default;
+
+  explicit json_value(const bool value) : data_{value} {}
+
+  explicit json_value(const std::int64_t value) : data_{value} {}
+
+  explicit json_value(const std::uint64_t value) : data_{value} {}
+
+  explicit json_value(const float value);
+
+  explicit json_value(const double value);
+
+  explicit json_value(string value) : data_{std::move(value)} {}
+
+  explicit json_value(array value) : data_{std::move(value)} {}
+
+  explicit json_value(object value) : data_{std::move(value)} {}
+
+  explicit json_value(const deferred value) : data_{value} {}
+
+  template <typename T> inline bool is() const { return std::holds_alternative<T>(data_); }
+
+  inline bool is_number() const
+  {
+    return is<std::int64_t>() or is<std::uint64_t>() or is<float>() or is<double>();
+  }
+
+  template <typename T> inline const T& get() const
+  {
+    if (const auto* const value = std::get_if<T>(&data_); value != nullptr)
+    {
+      return *value;
+    }
+    throw std::runtime_error{"JSON value type mismatch"};
+  }
+
+  template <typename T> inline T& get() { return const_cast<T&>(static_cast<const json_value&>(*this).get<T>()); }
+
+  /**
+   * @brief Returns number as \p NumberT, which is one of <code>std::int64_t</code>, <code>std::uint64_t</code>,
+   *        <code>float</code> or <code>double</code>, converting between number representations where the value is
+   *        in range
+   */
+  template <typename NumberT> NumberT to_number() const;
+
+  /**
+   * @brief Writes the value as JSON text to \p out
+   *
+   *        With \p workers, large arrays which are not inside of another array are split into one run of elements per
+   *        thread of the pool. The first run is written to \p out directly while the others are formatted into
+   *        separate buffers at the same time, which are then written in order.
+   */
+  void serialize(json_output_buffer& out, const bool prettify = false, json_worker_pool* workers = nullptr) const;
+
+private:
+  void serialize_indented(json_output_buffer& out, const int indent, json_worker_pool* workers) const;
+
+  /**
+   * @brief Writes the elements in [\p first, \p last) of an array, preceded by a separator unless \p first is its
+   *        first element
+   */
+  static void serialize_elements(
+    json_output_buffer& out,
+    const array& arr,
+    const std::size_t first,
+    const std::size_t last,
+    const int indent);
+
+  static void serialize_elements_parallel(
+    json_output_buffer& out,
+    const array& arr,
+    const int indent,
+    const std::size_t threads,
+    json_worker_pool& workers);
+
+  std::variant<null, bool, std::int64_t, std::uint64_t, float, double, string, array, object, deferred> data_;
+};
+
+template <> std::int64_t json_value::to_number<std::int64_t>() const;
+
+template <> std::uint64_t json_value::to_number<std::uint64_t>() const;
+
+template <> float json_value::to_number<float>() const;
+
+template <> double json_value::to_number<double>() const;
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_VALUE_H
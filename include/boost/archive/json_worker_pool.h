@@ -0,0 +1,79 @@
+#ifndef BOOST_ARCHIVE_JSON_WORKER_POOL_H
+#define BOOST_ARCHIVE_JSON_WORKER_POOL_H
+
+// C++ Standard Library
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Threads started once per archive, which run the runs of elements of every large array it parses or formats
+ *
+ *        The pool has one thread per hardware thread, including the thread which calls \p run, so that an archive
+ *        never has more threads working than there are hardware threads to run them.
+ */
+class json_worker_pool
+{
+public:
+  /**
+   * @brief Starts one worker less than the number of hardware threads, or none if it is unknown
+   */
+  json_worker_pool();
+
+  json_worker_pool(const json_worker_pool&) = delete;
+
+  /**
+   * @brief Stops and joins all workers
+   */
+  ~json_worker_pool();
+
+  /**
+   * @brief Returns the number of threads which can run tasks at once, including the caller of \p run
+   */
+  inline std::size_t size() const { return workers_.size() + 1; }
+
+  /**
+   * @brief Calls \p task with each index below \p count, which is at most \p size, and waits for all of them
+   *
+   *        Index 0 runs on the calling thread, and each other index on its own worker. If any task throws, the
+   *        exception of the lowest index is rethrown once all of them have finished.
+   */
+  void run(const std::size_t count, const std::function<void(std::size_t)>& task);
+
+private:
+  /**
+   * @brief Stops and joins all workers started so far
+   */
+  void stop();
+
+  void work(const std::size_t index);
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable started_;
+  std::condition_variable finished_;
+
+  /// Task of the current run, and the number of its indices
+  const std::function<void(std::size_t)>* task_ = nullptr;
+  std::size_t count_ = 0;
+
+  /// Incremented for each run, so that each worker takes part in a run only once
+  std::size_t generation_ = 0;
+  std::size_t n_running_ = 0;
+  bool stopping_ = false;
+  std::vector<std::exception_ptr> errors_;
+};
+
+}  // archive
+}  // boost
+
+#endif  // BOOST_ARCHIVE_JSON_WORKER_POOL_H
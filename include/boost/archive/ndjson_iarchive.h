@@ -0,0 +1,64 @@
+#ifndef BOOST_ARCHIVE_NDJSON_IARCHIVE_H
+#define BOOST_ARCHIVE_NDJSON_IARCHIVE_H
+
+// C++ Standard Library
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+
+// Boost
+#include <boost/archive/detail/register_archive.hpp>
+
+// Boost Archive JSON
+#include <boost/archive/basic_json_iarchive.h>
+#include <boost/archive/json_stream_reader.h>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Reads newline-delimited JSON written by \p ndjson_oarchive, one record at a time
+ *
+ *        Each record is read incrementally, like \p json_stream_iarchive reads a whole document, so memory use does
+ *        not grow with the number of records. Values which are not loaded from a record are skipped.
+ *
+ * @code
+ *   while (ar.next_record())
+ *   {
+ *     ar >> boost::serialization::make_nvp("event", event);
+ *   }
+ * @endcode
+ */
+class ndjson_iarchive : public basic_json_iarchive<ndjson_iarchive, json_stream_reader>
+{
+public:
+  explicit ndjson_iarchive(std::istream& is);
+
+  /**
+   * @brief Reads directly from \p size characters at \p data, which must outlive the archive
+   */
+  ndjson_iarchive(const char* data, const std::size_t size);
+
+  /**
+   * @brief Memory-maps the file at \p path, which stays mapped for the lifetime of the archive
+   */
+  explicit ndjson_iarchive(const std::filesystem::path& path);
+
+  ~ndjson_iarchive() = default;
+
+  /**
+   * @brief Moves to the next record, which must be called before loading from each record (including the first)
+   *
+   * @return <code>false</code> if there are no more records
+   */
+  bool next_record();
+};
+
+}  // archive
+}  // boost
+
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(boost::archive::ndjson_iarchive)
+
+#endif  // BOOST_ARCHIVE_NDJSON_IARCHIVE_H
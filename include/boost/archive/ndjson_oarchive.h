@@ -0,0 +1,75 @@
+#ifndef BOOST_ARCHIVE_NDJSON_OARCHIVE_H
+#define BOOST_ARCHIVE_NDJSON_OARCHIVE_H
+
+// C++ Standard Library
+#include <ostream>
+#include <type_traits>
+
+// Boost
+#include <boost/archive/detail/register_archive.hpp>
+
+// Boost Archive JSON
+#include <boost/archive/basic_json_oarchive.h>
+#include <boost/archive/json_stream_writer.h>
+
+namespace boost
+{
+namespace archive
+{
+
+/**
+ * @brief Writes newline-delimited JSON, one record (a compact JSON object) per line, as records are completed
+ *
+ *        By default, each top-level value is written as a record of its own, e.g. <code>{"event":{...}}</code>,
+ *        and handed to the output as soon as it has been saved. Otherwise, a record holds all top-level values saved
+ *        since the previous call to \p flush_record. Any open record is written on destruction.
+ *
+ *        Class metadata is written only with the first record of each class, as in the other archives, so records
+ *        are read back by one \p ndjson_iarchive from the start of the output.
+ */
+class ndjson_oarchive : public basic_json_oarchive<ndjson_oarchive, json_stream_writer>
+{
+public:
+  /**
+   * @param record_per_value  write each top-level value as a record of its own
+   * @param flags  <code>boost::archive::archive_flags</code> and \p json_archive_flags
+   */
+  explicit ndjson_oarchive(std::ostream& os, const bool record_per_value = true, const unsigned int flags = 0);
+
+  /**
+   * @brief Writes to any \p sink with a <code>write(const char* data, std::size_t size)</code> member
+   */
+  template <typename SinkT, typename = std::enable_if_t<!std::is_base_of<std::ostream, SinkT>::value>>
+  explicit ndjson_oarchive(SinkT& sink, const bool record_per_value = true, const unsigned int flags = 0) :
+      basic_json_oarchive<ndjson_oarchive, json_stream_writer>{flags, sink, false, true},
+      record_per_value_{record_per_value}
+  {}
+
+  ~ndjson_oarchive();
+
+  using basic_json_oarchive<ndjson_oarchive, json_stream_writer>::save_override;
+
+  template <typename T> void save_override(const boost::serialization::nvp<T>& kv)
+  {
+    basic_json_oarchive<ndjson_oarchive, json_stream_writer>::save_override(kv);
+    if (record_per_value_ and json_.at_root())
+    {
+      json_.end_record();
+    }
+  }
+
+  /**
+   * @brief Writes the top-level values saved since the previous record as one line, unless there are none
+   */
+  inline void flush_record() { json_.end_record(); }
+
+private:
+  bool record_per_value_;
+};
+
+}  // archive
+}  // boost
+
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(boost::archive::ndjson_oarchive)
+
+#endif  // BOOST_ARCHIVE_NDJSON_OARCHIVE_H
@@ -0,0 +1,205 @@
+// C++ Standard Library
+#include <stdexcept>
+#include <string_view>
+
+// Boost Archive JSON
+#include <boost/archive/json_document.h>
+
+namespace boost
+{
+namespace archive
+{
+
+json_document::json_document(json_value root) :
+    root_{std::move(root)}
+{
+  ctx_push(root_);
+}
+
+json_document::json_document(std::pmr::memory_resource* upstream) :
+    arena_{upstream},
+    pool_{std::addressof(arena_)},
+    root_{json_value::object{std::addressof(pool_)}}
+{
+  ctx_push(root_);
+}
+
+std::pmr::memory_resource* json_document::add_thread_resource()
+{
+  return std::addressof(thread_arenas_.emplace_front(arena_.upstream_resource()));
+}
+
+void json_document::ctx_start(const char* tag)
+{
+  if (!active().is<json_value::object>())
+  {
+    throw json_archive_exception{"Current JSON context is empty"};
+  }
+
+  auto& ctx = active().get<json_value::object>();
+
+  // Looked up before pushing, which may move the top context
+  auto& top = ctx_stack_.top();
+  json_value& member = (top.schema == nullptr) ? *ctx.try_emplace(tag).first : schema_emplace(top, ctx, tag);
+  ctx_push(member);
+}
+
+void json_document::ctx_start_key(const std::string_view key)
+{
+  if (!active().is<json_value::object>())
+  {
+    throw json_archive_exception{"Current JSON context is empty"};
+  }
+
+  ctx_push(active().get<json_value::object>().emplace_back(key));
+}
+
+bool json_document::ctx_find(const char* tag)
+{
+  if (!active().is<json_value::object>())
+  {
+    throw json_archive_exception{"Current JSON context is empty"};
+  }
+
+  auto& ctx = active().get<json_value::object>();
+  auto& cursor = ctx_stack_.top().cursor;
+  const std::string_view key{tag};
+
+  std::size_t n = cursor;
+  if (n < ctx.size() and ctx[n].first == key)
+  {
+    ++lookup_stats_.cursor_hits;
+  }
+  else
+  {
+    ++lookup_stats_.cursor_misses;
+    if (n = ctx.position(key); n == json_object::npos)
+    {
+      return false;
+    }
+  }
+
+  cursor = n + 1;
+  ctx_push(ctx[n].second);
+  return true;
+}
+
+bool json_document::ctx_find_next(const char* tag)
+{
+  if (!active().is<json_value::object>())
+  {
+    throw json_archive_exception{"Current JSON context is empty"};
+  }
+
+  auto& ctx = active().get<json_value::object>();
+  auto& cursor = ctx_stack_.top().cursor;
+  if (cursor == ctx.size() or ctx[cursor].first != std::string_view{tag})
+  {
+    return false;
+  }
+
+  ++lookup_stats_.cursor_hits;
+  ctx_push(ctx[cursor++].second);
+  return true;
+}
+
+void json_document::ctx_end(const char* tag) { ctx_pop(); }
+
+void json_document::ctx_push(json_value& value)
+{
+  if (deferred_parser_ != nullptr and value.is<json_value::deferred>())
+  {
+    deferred_parser_(value, resource());
+  }
+  ctx_stack_.push(context{std::addressof(value), 0, nullptr});
+}
+
+void json_document::array_start(const std::size_t reserve)
+{
+  active() = json_value{json_value::array{resource()}};
+  auto& arr_ctx = active().get<json_value::array>();
+  arr_ctx.reserve(reserve);
+  ctx_stack_.push(context{nullptr, 0, nullptr});
+}
+
+void json_document::array_push()
+{
+  ctx_pop();
+  auto& arr_ctx = active().get<json_value::array>();
+  arr_ctx.emplace_back();
+  ctx_push(arr_ctx.back());
+}
+
+void json_document::array_end() { ctx_pop(); }
+
+void json_document::array_next() { ctx_pop(); }
+
+void json_document::object_start()
+{
+  active() = json_value{json_value::object{resource()}};
+  ctx_stack_.top().schema = nullptr;
+}
+
+void json_document::object_start(const std::size_t reserve)
+{
+  object_start();
+  active().get<json_value::object>().reserve(reserve);
+}
+
+void json_document::object_start(json_object_schema& schema)
+{
+  active() = json_value{json_value::object{resource()}};
+  auto& top = ctx_stack_.top();
+  top.cursor = 0;
+  if (schema.status() == json_object_schema::state::complete)
+  {
+    top.value->get<json_value::object>().reserve(schema.size());
+    top.schema = std::addressof(schema);
+  }
+  else
+  {
+    top.schema = schema.start() ? std::addressof(schema) : nullptr;
+  }
+}
+
+json_value& json_document::schema_emplace(context& ctx, json_object& object, const char* tag)
+{
+  auto& schema = *ctx.schema;
+  if (schema.status() == json_object_schema::state::recording)
+  {
+    const auto [member, appended] = object.try_emplace(tag);
+    if (appended)
+    {
+      schema.record(tag);
+    }
+    else
+    {
+      schema.invalidate();
+      ctx.schema = nullptr;
+    }
+    return *member;
+  }
+
+  // Names which are looked up are not in the schema past the cursor, so names appended directly never repeat them
+  if (const std::size_t n = schema.find(tag, ctx.cursor); n < schema.size())
+  {
+    ctx.cursor = n + 1;
+    return object.emplace_back(tag);
+  }
+  return *object.try_emplace(tag).first;
+}
+
+void json_document::check_active() const
+{
+  if (ctx_stack_.empty())
+  {
+    throw std::logic_error{"JSON value stack is empty"};
+  }
+  else if (ctx_stack_.top().value == nullptr)
+  {
+    throw std::logic_error{"Forgot to call `json_document::array_push`"};
+  }
+}
+
+}  // namespace archive
+}  // namespace boost
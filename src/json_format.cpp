@@ -0,0 +1,112 @@
+// C++ Standard Library
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+// Boost Archive JSON
+#include <boost/archive/json_format.h>
+#include <boost/archive/json_string_scan.h>
+
+namespace boost
+{
+namespace archive
+{
+namespace
+{
+
+constexpr std::size_t indent_width = 2;
+
+constexpr char hex_digits[] = "0123456789abcdef";
+
+template <typename IntegerT> inline void write_integer(json_output_buffer& out, const IntegerT value)
+{
+  char buf[24];
+  const auto result = std::to_chars(buf, buf + sizeof(buf), value);
+  out.write(buf, static_cast<std::size_t>(result.ptr - buf));
+}
+
+template <typename FloatT> inline void write_floating_point(json_output_buffer& out, const FloatT value)
+{
+  if (std::isnan(value) or std::isinf(value))
+  {
+    throw std::overflow_error{"JSON does not support non-finite numbers"};
+  }
+
+  // Shortest representation which reads back as the same value, independent of the current locale
+  char buf[32];
+  const auto result = std::to_chars(buf, buf + sizeof(buf), value);
+  out.write(buf, static_cast<std::size_t>(result.ptr - buf));
+}
+
+}  // namespace
+
+void write_json_string(json_output_buffer& out, const char* str, const std::size_t len)
+{
+  // Same escaping rules as picojson::serialize_str, with unescaped runs found by block and written as blocks
+  out.put('"');
+
+  const char* run = str;
+  const char* const last = str + len;
+  for (const char* p = find_json_escaped_char(str, last); p != last; p = find_json_escaped_char(run, last))
+  {
+    out.write(run, static_cast<std::size_t>(p - run));
+    run = p + 1;
+
+    switch (*p)
+    {
+    case '"':
+      out.write("\\\"", 2);
+      break;
+    case '\\':
+      out.write("\\\\", 2);
+      break;
+    case '/':
+      out.write("\\/", 2);
+      break;
+    case '\b':
+      out.write("\\b", 2);
+      break;
+    case '\f':
+      out.write("\\f", 2);
+      break;
+    case '\n':
+      out.write("\\n", 2);
+      break;
+    case '\r':
+      out.write("\\r", 2);
+      break;
+    case '\t':
+      out.write("\\t", 2);
+      break;
+    default: {
+      // Remaining escaped characters are all below 0x80
+      const char buf[6] = {'\\', 'u', '0', '0', hex_digits[(*p >> 4) & 0xf], hex_digits[*p & 0xf]};
+      out.write(buf, 6);
+      break;
+    }
+    }
+  }
+  out.write(run, static_cast<std::size_t>(last - run));
+
+  out.put('"');
+}
+
+void write_json_number(json_output_buffer& out, const std::int64_t value) { write_integer(out, value); }
+
+void write_json_number(json_output_buffer& out, const std::uint64_t value) { write_integer(out, value); }
+
+void write_json_number(json_output_buffer& out, const float value) { write_floating_point(out, value); }
+
+void write_json_number(json_output_buffer& out, const double value) { write_floating_point(out, value); }
+
+void write_json_indent(json_output_buffer& out, const std::size_t depth)
+{
+  out.put('\n');
+  for (std::size_t n = 0; n < depth * indent_width; ++n)
+  {
+    out.put(' ');
+  }
+}
+
+}  // namespace archive
+}  // namespace boost
@@ -1,3 +1,10 @@
+// C++ Standard Library
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
 // Boost
 #include <boost/archive/detail/archive_serializer_map.hpp>
 #include <boost/archive/impl/archive_serializer_map.ipp>
@@ -6,19 +13,170 @@
 
 // Boost Archive JSON
 #include <boost/archive/json_iarchive.h>
+#include <boost/archive/json_mapped_file.h>
+#include <boost/archive/json_structural_index.h>
+#include <boost/archive/json_tokenizer.h>
+#include <boost/archive/json_worker_pool.h>
 
 namespace boost
 {
 namespace archive
 {
+namespace
+{
+
+constexpr std::size_t read_chunk_size = 1 << 16;
+
+void read_all(std::istream& is, std::string& data)
+{
+  // Input already buffered by the stream is often all of it, and is read without growing past it
+  const std::streamsize n_available = is.rdbuf()->in_avail();
+  std::size_t chunk_size = (n_available > 0) ? static_cast<std::size_t>(n_available) + 1 : read_chunk_size;
+  std::size_t n_read = 0;
+  while (true)
+  {
+    data.resize(n_read + chunk_size);
+    const auto n_chunk = is.rdbuf()->sgetn(std::addressof(data[n_read]), static_cast<std::streamsize>(chunk_size));
+    n_read += (n_chunk > 0) ? static_cast<std::size_t>(n_chunk) : 0;
+    if (n_chunk < static_cast<std::streamsize>(chunk_size))
+    {
+      break;
+    }
+    chunk_size = read_chunk_size;
+  }
+  data.resize(n_read);
+}
+
+unsigned int buffers_flags(const unsigned int flags)
+{
+  // Thread arenas would share the unsynchronized block pool of the buffers
+  if (flags & json_parallel_parse)
+  {
+    throw std::invalid_argument{"json_parallel_parse can not be used with json_archive_buffers"};
+  }
+  return flags;
+}
+
+void parse_deferred(json_value& value, std::pmr::memory_resource* resource)
+{
+  const auto [text, offset] = value.get<json_value::deferred>();
+  json_tokenizer in{text.data(), text.size(), offset};
+  try
+  {
+    in.parse_shallow_value(value, resource);
+    if (in.peek_token() != EOF)
+    {
+      in.error("Unexpected trailing characters");
+    }
+  }
+  catch (const std::runtime_error& err)
+  {
+    throw json_archive_exception{err.what()};
+  }
+}
+
+void parse(json_document& json, const char* data, const std::size_t size, const unsigned int flags)
+{
+  json_tokenizer in{data, size};
+  try
+  {
+    // Empty input leaves a null document, which fails on the first load
+    json.root() = json_value{};
+    if (in.peek_token() == EOF)
+    {
+      return;
+    }
+    else if (flags & json_lazy_parse)
+    {
+      in.parse_shallow_value(json.root(), json.resource());
+      json.set_deferred_parser(parse_deferred);
+    }
+    else if (flags & json_parallel_parse)
+    {
+      // Workers are started once, and parse every large array in the input
+      json_worker_pool workers;
+      std::vector<std::pmr::memory_resource*> thread_resources(workers.size());
+      for (auto& thread_resource : thread_resources)
+      {
+        thread_resource = json.add_thread_resource();
+      }
+      in.parse_parallel_value(json.root(), json.resource(), thread_resources, workers);
+    }
+    else if ((flags & json_indexed_parse) and size < json_structural_index::max_size)
+    {
+      in.parse_value(json.root(), json.resource(), json_structural_index{data, size});
+      return;
+    }
+    else
+    {
+      in.parse_value(json.root(), json.resource());
+    }
 
-json_iarchive::json_iarchive(std::istream& is) : json_{
-  [&is] {
-    picojson::value json;
-    picojson::parse(json, is);
-    return json;
-  }()}
-{}
+    if (in.peek_token() != EOF)
+    {
+      in.error("Unexpected trailing characters");
+    }
+  }
+  catch (const std::runtime_error& err)
+  {
+    throw json_archive_exception{err.what()};
+  }
+}
+
+}  // namespace
+
+json_iarchive::json_iarchive(std::istream& is, std::pmr::memory_resource* upstream, const unsigned int flags) :
+    basic_json_iarchive<json_iarchive, json_document>{flags, upstream}
+{
+  read_all(is, text_);
+  parse(json_, text_.data(), text_.size(), flags);
+  if (!(flags & json_lazy_parse))
+  {
+    std::string{}.swap(text_);
+  }
+}
+
+json_iarchive::json_iarchive(
+  const char* data,
+  const std::size_t size,
+  std::pmr::memory_resource* upstream,
+  const unsigned int flags) :
+    basic_json_iarchive<json_iarchive, json_document>{flags, upstream}
+{
+  parse(json_, data, size, flags);
+}
+
+json_iarchive::json_iarchive(std::istream& is, json_archive_buffers& buffers, const unsigned int flags) :
+    basic_json_iarchive<json_iarchive, json_document>{buffers_flags(flags), buffers.resource()}
+{
+  std::string& text = buffers.input_text();
+  read_all(is, text);
+  parse(json_, text.data(), text.size(), flags);
+}
+
+json_iarchive::json_iarchive(
+  const char* data,
+  const std::size_t size,
+  json_archive_buffers& buffers,
+  const unsigned int flags) :
+    basic_json_iarchive<json_iarchive, json_document>{buffers_flags(flags), buffers.resource()}
+{
+  parse(json_, data, size, flags);
+}
+
+json_iarchive::json_iarchive(
+  const std::filesystem::path& path,
+  std::pmr::memory_resource* upstream,
+  const unsigned int flags) :
+    basic_json_iarchive<json_iarchive, json_document>{flags, upstream}
+{
+  file_.emplace(path);
+  parse(json_, file_->data(), file_->size(), flags);
+  if (!(flags & json_lazy_parse))
+  {
+    file_.reset();
+  }
+}
 
 template class detail::archive_serializer_map<json_iarchive>;
 
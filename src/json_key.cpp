@@ -0,0 +1,79 @@
+// C++ Standard Library
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Boost Archive JSON
+#include <boost/archive/json_format.h>
+#include <boost/archive/json_key.h>
+#include <boost/archive/json_output_buffer.h>
+
+namespace boost
+{
+namespace archive
+{
+namespace
+{
+
+/// Keys are cached per thread in a table of 2^key_cache_bits entries
+constexpr std::size_t key_cache_bits = 8;
+
+constexpr std::size_t key_cache_size = std::size_t{1} << key_cache_bits;
+
+struct string_sink
+{
+  std::string* str;
+
+  inline void write(const char* data, const std::size_t size) { str->append(data, size); }
+};
+
+/**
+ * @brief Key cached for the last tag whose address mapped to this entry
+ */
+struct key_cache_entry
+{
+  const char* tag = nullptr;
+  std::string name;
+  std::string prefix;
+};
+
+inline std::size_t key_cache_slot(const char* tag)
+{
+  // Fibonacci hashing spreads nearby addresses (e.g. literals packed one after another) over all slots
+  const auto address = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(tag));
+  return static_cast<std::size_t>((address * 0x9E3779B97F4A7C15ULL) >> (64 - key_cache_bits));
+}
+
+/**
+ * @brief Returns <code>true</code> if \p tag is still the name which was cached for it
+ */
+inline bool matches(const key_cache_entry& entry, const char* tag)
+{
+  return entry.tag == tag and std::strncmp(entry.name.data(), tag, entry.name.size()) == 0 and
+    tag[entry.name.size()] == '\0';
+}
+
+}  // namespace
+
+json_key make_json_key(const char* tag)
+{
+  thread_local key_cache_entry cache[key_cache_size];
+
+  auto& entry = cache[key_cache_slot(tag)];
+  if (!matches(entry, tag))
+  {
+    entry.tag = tag;
+    entry.name.assign(tag);
+    entry.prefix.clear();
+
+    string_sink sink{&entry.prefix};
+    json_output_buffer out{sink, entry.name.size() + 8};
+    write_json_string(out, entry.name.data(), entry.name.size());
+    out.put(':');
+    out.flush();
+  }
+  return json_key{entry.name, entry.prefix};
+}
+
+}  // namespace archive
+}  // namespace boost
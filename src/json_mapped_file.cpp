@@ -0,0 +1,79 @@
+// C++ Standard Library
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Boost Archive JSON
+#include <boost/archive/json_document.h>
+#include <boost/archive/json_mapped_file.h>
+
+namespace boost
+{
+namespace archive
+{
+namespace
+{
+
+[[noreturn]] void throw_file_error(const std::filesystem::path& path, const char* what)
+{
+  throw json_archive_exception{std::string{what} + " '" + path.string() + "' : " + std::strerror(errno)};
+}
+
+}  // namespace
+
+json_mapped_file::json_mapped_file(const std::filesystem::path& path) : data_{nullptr}, size_{0}
+{
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    throw_file_error(path, "Failed to open");
+  }
+
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0)
+  {
+    ::close(fd);
+    throw_file_error(path, "Failed to stat");
+  }
+
+  size_ = static_cast<std::size_t>(file_stat.st_size);
+
+  // Zero-length mappings are not allowed; an empty file is just an empty range
+  if (size_ > 0)
+  {
+    void* const mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED)
+    {
+      ::close(fd);
+      throw_file_error(path, "Failed to map");
+    }
+    ::madvise(mapped, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(mapped);
+  }
+
+  // Mapping stays valid after its file descriptor is closed
+  ::close(fd);
+}
+
+json_mapped_file::json_mapped_file(json_mapped_file&& other) noexcept : data_{other.data_}, size_{other.size_}
+{
+  other.data_ = nullptr;
+  other.size_ = 0;
+}
+
+json_mapped_file::~json_mapped_file()
+{
+  if (data_ != nullptr)
+  {
+    ::munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+}  // namespace archive
+}  // namespace boost
@@ -1,6 +1,5 @@
 // C++ Standard Library
-#include <algorithm>
-#include <iterator>
+#include <memory>
 
 // Boost
 #include <boost/archive/detail/archive_serializer_map.hpp>
@@ -14,11 +13,38 @@ namespace boost
 namespace archive
 {
 
-json_oarchive::json_oarchive(std::ostream& os, const bool prettify) : json_{}, os_{std::addressof(os)}, prettify_{prettify}
+json_oarchive::json_oarchive(
+  std::ostream& os,
+  const bool prettify,
+  std::pmr::memory_resource* upstream,
+  const unsigned int flags) :
+    basic_json_oarchive<json_oarchive, json_document>{flags, upstream},
+    out_{os},
+    prettify_{prettify}
+{
+  start_workers();
+}
+
+json_oarchive::json_oarchive(std::ostream& os, const bool prettify, const unsigned int flags) :
+    json_oarchive{os, prettify, std::pmr::get_default_resource(), flags}
 {}
 
-json_oarchive::~json_oarchive() {
-  json_.serialize(std::ostream_iterator<char>(*os_), prettify_);
+json_oarchive::json_oarchive(
+  std::ostream& os,
+  json_archive_buffers& buffers,
+  const bool prettify,
+  const unsigned int flags) :
+    basic_json_oarchive<json_oarchive, json_document>{flags, buffers.resource()},
+    out_{os, buffers.output_block()},
+    prettify_{prettify}
+{
+  start_workers();
+}
+
+json_oarchive::~json_oarchive()
+{
+  json_.serialize(out_, prettify_, workers_ ? std::addressof(*workers_) : nullptr);
+  out_.flush();
 }
 
 template class detail::archive_serializer_map<json_oarchive>;
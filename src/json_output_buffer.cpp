@@ -0,0 +1,39 @@
+// Boost Archive JSON
+#include <boost/archive/json_output_buffer.h>
+
+namespace boost
+{
+namespace archive
+{
+
+void json_output_buffer::flush()
+{
+  if (pos_ != block_.data())
+  {
+    sink_write_(sink_, block_.data(), static_cast<std::size_t>(pos_ - block_.data()));
+    pos_ = block_.data();
+  }
+}
+
+void json_output_buffer::write_through(const char* data, const std::size_t size)
+{
+  // Top up the current block first, so that blocks handed to the sink stay full-sized
+  const std::size_t head = static_cast<std::size_t>(end_ - pos_);
+  std::memcpy(pos_, data, head);
+  pos_ = end_;
+  flush();
+
+  const std::size_t tail = size - head;
+  if (tail < block_.size())
+  {
+    std::memcpy(pos_, data + head, tail);
+    pos_ += tail;
+  }
+  else
+  {
+    sink_write_(sink_, data + head, tail);
+  }
+}
+
+}  // namespace archive
+}  // namespace boost
@@ -0,0 +1,28 @@
+// Boost
+#include <boost/archive/detail/archive_serializer_map.hpp>
+#include <boost/archive/impl/archive_serializer_map.ipp>
+
+// Boost Archive JSON
+#include <boost/archive/json_stream_iarchive.h>
+
+namespace boost
+{
+namespace archive
+{
+
+json_stream_iarchive::json_stream_iarchive(std::istream& is) :
+    basic_json_iarchive<json_stream_iarchive, json_stream_reader>{0, is}
+{}
+
+json_stream_iarchive::json_stream_iarchive(const char* data, const std::size_t size) :
+    basic_json_iarchive<json_stream_iarchive, json_stream_reader>{0, data, size}
+{}
+
+json_stream_iarchive::json_stream_iarchive(const std::filesystem::path& path) :
+    basic_json_iarchive<json_stream_iarchive, json_stream_reader>{0, json_mapped_file{path}}
+{}
+
+template class detail::archive_serializer_map<json_stream_iarchive>;
+
+}  // namespace archive
+}  // namespace boost
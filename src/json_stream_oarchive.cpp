@@ -0,0 +1,22 @@
+// Boost
+#include <boost/archive/detail/archive_serializer_map.hpp>
+#include <boost/archive/impl/archive_serializer_map.ipp>
+
+// Boost Archive JSON
+#include <boost/archive/json_stream_oarchive.h>
+
+namespace boost
+{
+namespace archive
+{
+
+json_stream_oarchive::json_stream_oarchive(std::ostream& os, const bool prettify, const unsigned int flags) :
+    basic_json_oarchive<json_stream_oarchive, json_stream_writer>{flags, os, prettify}
+{}
+
+json_stream_oarchive::~json_stream_oarchive() { json_.finish(); }
+
+template class detail::archive_serializer_map<json_stream_oarchive>;
+
+}  // namespace archive
+}  // namespace boost
@@ -0,0 +1,353 @@
+// C++ Standard Library
+#include <memory_resource>
+#include <stdexcept>
+#include <string_view>
+
+// Boost Archive JSON
+#include <boost/archive/json_stream_reader.h>
+
+namespace boost
+{
+namespace archive
+{
+
+json_stream_reader::json_stream_reader(std::istream& is) : frames_{}, in_{is}
+{
+  frames_.push_back(frame{frame_state::value, false, false, 0, {}, nullptr});
+}
+
+json_stream_reader::json_stream_reader(const char* data, const std::size_t size) : frames_{}, in_{data, size}
+{
+  frames_.push_back(frame{frame_state::value, false, false, 0, {}, nullptr});
+}
+
+json_stream_reader::json_stream_reader(json_mapped_file file) : frames_{}, in_{std::move(file)}
+{
+  frames_.push_back(frame{frame_state::value, false, false, 0, {}, nullptr});
+}
+
+json_stream_reader::~json_stream_reader() = default;
+
+bool json_stream_reader::ctx_find(const char* tag) { return find_member(tag, true); }
+
+bool json_stream_reader::ctx_find_next(const char* tag) { return find_member(tag, false); }
+
+bool json_stream_reader::find_member(const char* tag, const bool scan)
+{
+  auto* ctx = std::addressof(frames_.back());
+
+  if (ctx->state == frame_state::buffered)
+  {
+    if (!(scan ? ctx->buffered->ctx_find(tag) : ctx->buffered->ctx_find_next(tag)))
+    {
+      return false;
+    }
+    ++ctx->depth;
+    return true;
+  }
+  else if (ctx->state == frame_state::value and in_.peek_token() == '{')
+  {
+    in_.advance();
+    ctx->state = frame_state::object;
+    ctx->open = true;
+    ctx->first = true;
+  }
+  else if (ctx->state != frame_state::object)
+  {
+    throw json_archive_exception{"Current JSON context is empty"};
+  }
+
+  // Refers to the tag itself, which outlives the lookup, unlike names cached by make_json_key
+  const std::string_view name{tag};
+  if (const auto itr = ctx->skipped.find(name); itr != ctx->skipped.end())
+  {
+    auto buffered = std::make_unique<json_document>(std::move(itr->second));
+    ctx->skipped.erase(itr);
+    frames_.push_back(frame{frame_state::buffered, false, false, 0, {}, std::move(buffered)});
+    return true;
+  }
+
+  std::string_view key;
+  while (next_member(*ctx, key))
+  {
+    if (key == name)
+    {
+      frames_.push_back(frame{frame_state::value, false, false, 0, {}, nullptr});
+      return true;
+    }
+    else if (!scan)
+    {
+      // Kept unread, so that the next lookup starts from this member
+      ctx->peeked = true;
+      ctx->peeked_key.assign(key.data(), key.size());
+      return false;
+    }
+    in_.parse_value(ctx->skipped.try_emplace(std::string{key}).first->second, std::pmr::get_default_resource());
+  }
+
+  return false;
+}
+
+void json_stream_reader::ctx_end(const char* tag)
+{
+  auto& ctx = frames_.back();
+
+  if (ctx.state == frame_state::buffered and ctx.depth > 0)
+  {
+    ctx.buffered->ctx_end(tag);
+    --ctx.depth;
+    return;
+  }
+
+  close_value();
+}
+
+template <> bool json_stream_reader::get<bool>()
+{
+  if (frames_.back().state == frame_state::buffered)
+  {
+    return frames_.back().buffered->get<bool>();
+  }
+
+  auto& ctx = value_frame("Expected boolean value");
+  const bool value = in_.read_bool();
+  ctx.state = frame_state::closed;
+  return value;
+}
+
+template <> std::int64_t json_stream_reader::get<std::int64_t>() { return get_number<std::int64_t>(); }
+
+template <> std::uint64_t json_stream_reader::get<std::uint64_t>() { return get_number<std::uint64_t>(); }
+
+template <> float json_stream_reader::get<float>() { return get_number<float>(); }
+
+template <> double json_stream_reader::get<double>() { return get_number<double>(); }
+
+template <> std::string json_stream_reader::get<std::string>()
+{
+  if (frames_.back().state == frame_state::buffered)
+  {
+    return std::string{frames_.back().buffered->get<std::string>()};
+  }
+
+  auto& ctx = value_frame("Expected string value");
+  if (in_.peek_token() != '"')
+  {
+    throw std::runtime_error{"Expected string value"};
+  }
+  std::string value{in_.read_string_view(key_)};
+  ctx.state = frame_state::closed;
+  return value;
+}
+
+std::size_t json_stream_reader::array_size()
+{
+  // Number of elements is not known until the whole array has been read
+  return (frames_.back().state == frame_state::buffered) ? frames_.back().buffered->array_size() : 0;
+}
+
+std::size_t json_stream_reader::object_size()
+{
+  // Number of members is not known until the whole object has been read
+  return (frames_.back().state == frame_state::buffered) ? frames_.back().buffered->object_size() : 0;
+}
+
+void json_stream_reader::array_start()
+{
+  auto& ctx = value_frame("Expected array value");
+  if (in_.peek_token() != '[')
+  {
+    throw std::runtime_error{"Expected array value"};
+  }
+  in_.advance();
+  ctx.state = frame_state::array;
+  ctx.open = true;
+  ctx.first = true;
+}
+
+bool json_stream_reader::array_next()
+{
+  if (!next_element(frames_.back()))
+  {
+    return false;
+  }
+  frames_.push_back(frame{frame_state::value, false, false, 0, {}, nullptr});
+  return true;
+}
+
+void json_stream_reader::object_start()
+{
+  auto& ctx = value_frame("Expected object value");
+  if (in_.peek_token() != '{')
+  {
+    throw std::runtime_error{"Expected object value"};
+  }
+  in_.advance();
+  ctx.state = frame_state::object;
+  ctx.open = true;
+  ctx.first = true;
+}
+
+bool json_stream_reader::next_element(frame& ctx)
+{
+  int c = in_.peek_token();
+  if (c == ']')
+  {
+    in_.advance();
+    ctx.state = frame_state::closed;
+    ctx.open = false;
+    return false;
+  }
+  else if (!ctx.first)
+  {
+    in_.expect(',');
+  }
+  ctx.first = false;
+  return true;
+}
+
+bool json_stream_reader::is_object()
+{
+  const auto& ctx = frames_.back();
+  if (ctx.state == frame_state::buffered)
+  {
+    return ctx.buffered->is_object();
+  }
+  return ctx.state == frame_state::object or (ctx.state == frame_state::value and in_.peek_token() == '{');
+}
+
+bool json_stream_reader::is_null()
+{
+  const auto& ctx = frames_.back();
+  if (ctx.state == frame_state::buffered)
+  {
+    return ctx.buffered->is_null();
+  }
+  return ctx.state == frame_state::value and in_.peek_token() == 'n';
+}
+
+bool json_stream_reader::next_record()
+{
+  if (record_started_)
+  {
+    while (!frames_.empty())
+    {
+      close_value();
+    }
+    frames_.push_back(frame{frame_state::value, false, false, 0, {}, nullptr});
+  }
+  record_started_ = true;
+  return in_.peek_token() != EOF;
+}
+
+bool json_stream_reader::next_member(frame& ctx, std::string_view& key)
+{
+  if (!ctx.open)
+  {
+    return false;
+  }
+  else if (ctx.peeked)
+  {
+    ctx.peeked = false;
+    key_.swap(ctx.peeked_key);
+    key = key_;
+    return true;
+  }
+
+  int c = in_.peek_token();
+  if (c == '}')
+  {
+    in_.advance();
+    ctx.open = false;
+    return false;
+  }
+  else if (!ctx.first)
+  {
+    in_.expect(',');
+    c = in_.peek_token();
+  }
+  ctx.first = false;
+
+  if (c != '"')
+  {
+    in_.error("Expected object member name");
+  }
+  key = in_.read_string_view(key_);
+
+  // Keys which refer to the read buffer would be overwritten if the next chunk is read while looking for ':'
+  if (in_.reads_chunks() and key.data() != key_.data())
+  {
+    key_.assign(key.data(), key.size());
+    key = key_;
+  }
+  in_.expect(':');
+  return true;
+}
+
+void json_stream_reader::close_value()
+{
+  auto& ctx = frames_.back();
+
+  switch (ctx.state)
+  {
+  case frame_state::value:
+    in_.skip_value();
+    break;
+  case frame_state::object: {
+    std::string_view key;
+    while (next_member(ctx, key))
+    {
+      in_.skip_value();
+    }
+    break;
+  }
+  case frame_state::array:
+    while (frames_.back().open and array_next())
+    {
+      in_.skip_value();
+      frames_.pop_back();
+    }
+    break;
+  case frame_state::closed:
+  case frame_state::buffered:
+    break;
+  }
+
+  frames_.pop_back();
+}
+
+template <typename NumberT> NumberT json_stream_reader::get_number()
+{
+  if (frames_.back().state == frame_state::buffered)
+  {
+    return frames_.back().buffered->get<NumberT>();
+  }
+
+  auto& ctx = value_frame("Expected number value");
+  const NumberT value = read_number().to_number<NumberT>();
+  ctx.state = frame_state::closed;
+  return value;
+}
+
+const json_value& json_stream_reader::read_number()
+{
+  const int c = in_.peek_token();
+  if (c != '-' and !('0' <= c and c <= '9'))
+  {
+    throw std::runtime_error{"Expected number value"};
+  }
+  in_.read_number(number_);
+  return number_;
+}
+
+json_stream_reader::frame& json_stream_reader::value_frame(const char* expected)
+{
+  if (frames_.back().state != frame_state::value)
+  {
+    throw std::runtime_error{expected};
+  }
+  return frames_.back();
+}
+
+}  // namespace archive
+}  // namespace boost
@@ -0,0 +1,278 @@
+// C++ Standard Library
+#include <stdexcept>
+
+// Boost Archive JSON
+#include <boost/archive/json_document.h>
+#include <boost/archive/json_format.h>
+#include <boost/archive/json_key.h>
+#include <boost/archive/json_stream_writer.h>
+
+namespace boost
+{
+namespace archive
+{
+
+void json_stream_writer::ctx_start(const char* tag)
+{
+  member_start();
+  const json_key key = make_json_key(tag);
+  out_.write(key.prefix.data(), key.prefix.size());
+  member_value_start();
+}
+
+void json_stream_writer::ctx_start_key(const std::string_view key)
+{
+  member_start();
+  write_json_string(out_, key.data(), key.size());
+  out_.put(':');
+  member_value_start();
+}
+
+void json_stream_writer::ctx_end(const char* tag)
+{
+  close_value();
+
+  // Hand each completed top-level member to the sink
+  if (frames_.size() == 1 and !flush_records_)
+  {
+    out_.flush();
+  }
+}
+
+void json_stream_writer::object_start()
+{
+  if (frames_.back().state == frame_state::value)
+  {
+    frames_.back().state = frame_state::object_pending;
+  }
+}
+
+void json_stream_writer::array_start(const std::size_t reserve)
+{
+  auto& ctx = frames_.back();
+
+  if (ctx.state != frame_state::value and ctx.state != frame_state::object_pending)
+  {
+    throw std::logic_error{"JSON value was already written"};
+  }
+
+  out_.put('[');
+  ctx.state = frame_state::array;
+  ctx.count = 0;
+}
+
+void json_stream_writer::array_push()
+{
+  if (frames_.back().state != frame_state::array)
+  {
+    close_value();
+  }
+
+  write_separator(frames_.back());
+  frames_.push_back(frame{frame_state::value, 0});
+}
+
+void json_stream_writer::array_end()
+{
+  if (frames_.back().state != frame_state::array)
+  {
+    close_value();
+  }
+
+  auto& ctx = frames_.back();
+  if (prettify_ and ctx.count > 0)
+  {
+    write_json_indent(out_, frames_.size() - 1);
+  }
+  out_.put(']');
+  ctx.state = frame_state::closed;
+}
+
+void json_stream_writer::put(const bool value)
+{
+  auto& ctx = value_frame();
+
+  if (value)
+  {
+    out_.write("true", 4);
+  }
+  else
+  {
+    out_.write("false", 5);
+  }
+  ctx.state = frame_state::closed;
+}
+
+void json_stream_writer::put(const std::int64_t value)
+{
+  auto& ctx = value_frame();
+  write_json_number(out_, value);
+  ctx.state = frame_state::closed;
+}
+
+void json_stream_writer::put(const std::uint64_t value)
+{
+  auto& ctx = value_frame();
+  write_json_number(out_, value);
+  ctx.state = frame_state::closed;
+}
+
+void json_stream_writer::put(const float value)
+{
+  auto& ctx = value_frame();
+  write_json_number(out_, value);
+  ctx.state = frame_state::closed;
+}
+
+void json_stream_writer::put(const double value)
+{
+  auto& ctx = value_frame();
+  write_json_number(out_, value);
+  ctx.state = frame_state::closed;
+}
+
+void json_stream_writer::put(const std::string& value)
+{
+  auto& ctx = value_frame();
+  write_json_string(out_, value.data(), value.size());
+  ctx.state = frame_state::closed;
+}
+
+void json_stream_writer::put_null()
+{
+  auto& ctx = value_frame();
+  out_.write("null", 4);
+  ctx.state = frame_state::closed;
+}
+
+void json_stream_writer::finish()
+{
+  if (frames_.empty())
+  {
+    return;
+  }
+
+  while (!frames_.empty())
+  {
+    if (frames_.back().state == frame_state::array)
+    {
+      array_end();
+    }
+    close_value();
+  }
+
+  if (prettify_)
+  {
+    out_.put('\n');
+  }
+  out_.flush();
+}
+
+void json_stream_writer::end_record()
+{
+  if (!at_root())
+  {
+    throw std::logic_error{"JSON record ended inside of a value"};
+  }
+  else if (frames_.back().state == frame_state::object_pending)
+  {
+    return;
+  }
+
+  close_value();
+  out_.put('\n');
+  out_.flush();
+  frames_.push_back(frame{frame_state::object_pending, 0});
+}
+
+void json_stream_writer::finish_record()
+{
+  while (!at_root())
+  {
+    if (frames_.back().state == frame_state::array)
+    {
+      array_end();
+    }
+    close_value();
+  }
+
+  end_record();
+}
+
+void json_stream_writer::member_start()
+{
+  auto& ctx = frames_.back();
+
+  if (ctx.state == frame_state::object_pending)
+  {
+    out_.put('{');
+    ctx.state = frame_state::object;
+  }
+  else if (ctx.state != frame_state::object)
+  {
+    throw json_archive_exception{"Current JSON context is empty"};
+  }
+
+  write_separator(ctx);
+}
+
+void json_stream_writer::member_value_start()
+{
+  if (prettify_)
+  {
+    out_.put(' ');
+  }
+
+  frames_.push_back(frame{frame_state::value, 0});
+}
+
+void json_stream_writer::close_value()
+{
+  const frame ctx = frames_.back();
+  frames_.pop_back();
+
+  switch (ctx.state)
+  {
+  case frame_state::value:
+    out_.write("null", 4);
+    break;
+  case frame_state::object_pending:
+    out_.write("{}", 2);
+    break;
+  case frame_state::object:
+    if (prettify_ and ctx.count > 0)
+    {
+      write_json_indent(out_, frames_.size());
+    }
+    out_.put('}');
+    break;
+  case frame_state::array:
+    throw std::logic_error{"Forgot to call `json_stream_writer::array_end`"};
+  case frame_state::closed:
+    break;
+  }
+}
+
+void json_stream_writer::write_separator(frame& container)
+{
+  if (container.count++ > 0)
+  {
+    out_.put(',');
+  }
+  if (prettify_)
+  {
+    write_json_indent(out_, frames_.size());
+  }
+}
+
+json_stream_writer::frame& json_stream_writer::value_frame()
+{
+  if (frames_.back().state != frame_state::value and frames_.back().state != frame_state::object_pending)
+  {
+    throw std::logic_error{"JSON value was already written"};
+  }
+  return frames_.back();
+}
+
+}  // namespace archive
+}  // namespace boost
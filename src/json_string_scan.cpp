@@ -0,0 +1,254 @@
+// C++ Standard Library
+#include <cstdint>
+
+// Boost Archive JSON
+#include <boost/archive/json_string_scan.h>
+
+// Define BOOST_ARCHIVE_JSON_NO_SIMD to always use the scalar scanners
+#if (defined(__x86_64__) or defined(_M_X64)) and !defined(BOOST_ARCHIVE_JSON_NO_SIMD)
+#define BOOST_ARCHIVE_JSON_STRING_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER) and !defined(__clang__)
+#include <intrin.h>
+#elif defined(__GNUC__) or defined(__clang__)
+#define BOOST_ARCHIVE_JSON_TARGET_AVX2 __attribute__((target("avx2")))
+#define BOOST_ARCHIVE_JSON_HAS_AVX2 1
+#endif
+
+namespace boost
+{
+namespace archive
+{
+namespace
+{
+
+const char* find_escaped_char_scalar(const char* first, const char* last)
+{
+  while (first != last and !detail::is_json_escaped_char(*first))
+  {
+    ++first;
+  }
+  return first;
+}
+
+const char* find_string_special_scalar(const char* first, const char* last)
+{
+  while (first != last and !detail::is_json_string_special(*first))
+  {
+    ++first;
+  }
+  return first;
+}
+
+const char* find_nesting_char_scalar(const char* first, const char* last)
+{
+  while (first != last and !detail::is_json_nesting_char(*first))
+  {
+    ++first;
+  }
+  return first;
+}
+
+inline int first_set_bit(const std::uint32_t mask)
+{
+#if defined(_MSC_VER) and !defined(__clang__)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+#ifdef BOOST_ARCHIVE_JSON_STRING_SCAN_X86
+
+// SSE2 is part of the x86-64 baseline, so these need no runtime check
+
+inline __m128i sse2_escaped_mask(const __m128i block)
+{
+  const __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(block, _mm_set1_epi8(0x1f)), _mm_set1_epi8(0x1f));
+  const __m128i quote = _mm_cmpeq_epi8(block, _mm_set1_epi8('"'));
+  const __m128i backslash = _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'));
+  const __m128i slash = _mm_cmpeq_epi8(block, _mm_set1_epi8('/'));
+  const __m128i del = _mm_cmpeq_epi8(block, _mm_set1_epi8(0x7f));
+  return _mm_or_si128(_mm_or_si128(control, quote), _mm_or_si128(_mm_or_si128(backslash, slash), del));
+}
+
+inline __m128i sse2_special_mask(const __m128i block)
+{
+  return _mm_or_si128(
+    _mm_cmpeq_epi8(block, _mm_set1_epi8('"')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\\')));
+}
+
+// '[' and ']' differ from '{' and '}' only in bit 0x20
+inline __m128i sse2_nesting_mask(const __m128i block)
+{
+  const __m128i folded = _mm_or_si128(block, _mm_set1_epi8(0x20));
+  return _mm_or_si128(
+    _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')), _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+    _mm_cmpeq_epi8(block, _mm_set1_epi8('"')));
+}
+
+const char* find_escaped_char_sse2(const char* first, const char* last)
+{
+  for (; last - first >= 16; first += 16)
+  {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    if (const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(sse2_escaped_mask(block))); mask != 0)
+    {
+      return first + first_set_bit(mask);
+    }
+  }
+  return find_escaped_char_scalar(first, last);
+}
+
+const char* find_string_special_sse2(const char* first, const char* last)
+{
+  for (; last - first >= 16; first += 16)
+  {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    if (const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(sse2_special_mask(block))); mask != 0)
+    {
+      return first + first_set_bit(mask);
+    }
+  }
+  return find_string_special_scalar(first, last);
+}
+
+const char* find_nesting_char_sse2(const char* first, const char* last)
+{
+  for (; last - first >= 16; first += 16)
+  {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    if (const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(sse2_nesting_mask(block))); mask != 0)
+    {
+      return first + first_set_bit(mask);
+    }
+  }
+  return find_nesting_char_scalar(first, last);
+}
+
+#ifdef BOOST_ARCHIVE_JSON_HAS_AVX2
+
+BOOST_ARCHIVE_JSON_TARGET_AVX2 const char* find_escaped_char_avx2(const char* first, const char* last)
+{
+  const __m256i control_max = _mm256_set1_epi8(0x1f);
+  const __m256i quote = _mm256_set1_epi8('"');
+  const __m256i backslash = _mm256_set1_epi8('\\');
+  const __m256i slash = _mm256_set1_epi8('/');
+  const __m256i del = _mm256_set1_epi8(0x7f);
+  for (; last - first >= 32; first += 32)
+  {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    const __m256i escaped = _mm256_or_si256(
+      _mm256_or_si256(
+        _mm256_cmpeq_epi8(_mm256_max_epu8(block, control_max), control_max), _mm256_cmpeq_epi8(block, quote)),
+      _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(block, backslash), _mm256_cmpeq_epi8(block, slash)),
+        _mm256_cmpeq_epi8(block, del)));
+    if (const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(escaped)); mask != 0)
+    {
+      return first + first_set_bit(mask);
+    }
+  }
+  return find_escaped_char_sse2(first, last);
+}
+
+BOOST_ARCHIVE_JSON_TARGET_AVX2 const char* find_string_special_avx2(const char* first, const char* last)
+{
+  const __m256i quote = _mm256_set1_epi8('"');
+  const __m256i backslash = _mm256_set1_epi8('\\');
+  for (; last - first >= 32; first += 32)
+  {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    const __m256i special = _mm256_or_si256(_mm256_cmpeq_epi8(block, quote), _mm256_cmpeq_epi8(block, backslash));
+    if (const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(special)); mask != 0)
+    {
+      return first + first_set_bit(mask);
+    }
+  }
+  return find_string_special_sse2(first, last);
+}
+
+BOOST_ARCHIVE_JSON_TARGET_AVX2 const char* find_nesting_char_avx2(const char* first, const char* last)
+{
+  const __m256i case_bit = _mm256_set1_epi8(0x20);
+  const __m256i open = _mm256_set1_epi8('{');
+  const __m256i close = _mm256_set1_epi8('}');
+  const __m256i quote = _mm256_set1_epi8('"');
+  for (; last - first >= 32; first += 32)
+  {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    const __m256i folded = _mm256_or_si256(block, case_bit);
+    const __m256i nesting = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(folded, open), _mm256_cmpeq_epi8(folded, close)),
+      _mm256_cmpeq_epi8(block, quote));
+    if (const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(nesting)); mask != 0)
+    {
+      return first + first_set_bit(mask);
+    }
+  }
+  return find_nesting_char_sse2(first, last);
+}
+
+#endif  // BOOST_ARCHIVE_JSON_HAS_AVX2
+
+#endif  // BOOST_ARCHIVE_JSON_STRING_SCAN_X86
+
+/**
+ * @brief String scanners for the best instruction set supported by the running CPU
+ */
+struct string_scan_impl
+{
+  const char* (*find_escaped_char)(const char*, const char*);
+  const char* (*find_string_special)(const char*, const char*);
+  const char* (*find_nesting_char)(const char*, const char*);
+};
+
+string_scan_impl select_string_scan_impl()
+{
+#ifdef BOOST_ARCHIVE_JSON_STRING_SCAN_X86
+#ifdef BOOST_ARCHIVE_JSON_HAS_AVX2
+  if (__builtin_cpu_supports("avx2"))
+  {
+    return {find_escaped_char_avx2, find_string_special_avx2, find_nesting_char_avx2};
+  }
+#endif  // BOOST_ARCHIVE_JSON_HAS_AVX2
+  return {find_escaped_char_sse2, find_string_special_sse2, find_nesting_char_sse2};
+#else
+  return {find_escaped_char_scalar, find_string_special_scalar, find_nesting_char_scalar};
+#endif  // BOOST_ARCHIVE_JSON_STRING_SCAN_X86
+}
+
+const string_scan_impl& string_scan()
+{
+  static const string_scan_impl impl = select_string_scan_impl();
+  return impl;
+}
+
+}  // namespace
+
+namespace detail
+{
+
+const char* find_json_escaped_char_block(const char* first, const char* last)
+{
+  return string_scan().find_escaped_char(first, last);
+}
+
+const char* find_json_string_special_block(const char* first, const char* last)
+{
+  return string_scan().find_string_special(first, last);
+}
+
+const char* find_json_nesting_char_block(const char* first, const char* last)
+{
+  return string_scan().find_nesting_char(first, last);
+}
+
+}  // namespace detail
+
+}  // namespace archive
+}  // namespace boost
@@ -0,0 +1,300 @@
+// C++ Standard Library
+#include <algorithm>
+#include <cstring>
+
+// Boost Archive JSON
+#include <boost/archive/json_structural_index.h>
+
+// Define BOOST_ARCHIVE_JSON_NO_SIMD to always classify characters one at a time
+#if (defined(__x86_64__) or defined(_M_X64)) and !defined(BOOST_ARCHIVE_JSON_NO_SIMD)
+#define BOOST_ARCHIVE_JSON_STRUCTURAL_INDEX_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER) and !defined(__clang__)
+#include <intrin.h>
+#elif defined(__GNUC__) or defined(__clang__)
+#define BOOST_ARCHIVE_JSON_TARGET_AVX2 __attribute__((target("avx2")))
+#define BOOST_ARCHIVE_JSON_HAS_AVX2 1
+#endif
+
+namespace boost
+{
+namespace archive
+{
+namespace
+{
+
+constexpr std::size_t block_size = 64;
+
+/**
+ * @brief One bit per character of a 64-character block, for each class of character
+ */
+struct block_masks
+{
+  std::uint64_t backslash;
+  std::uint64_t quote;
+  std::uint64_t op;
+  std::uint64_t whitespace;
+};
+
+/**
+ * @brief Carried from one block to the next
+ */
+struct block_state
+{
+  /// Low bit set if the block ended in an odd-length run of backslashes
+  std::uint64_t odd_backslashes = 0;
+  /// All bits set if the block ended inside of a string
+  std::uint64_t in_string = 0;
+  /// Low bit set if the block ended with a character which cannot continue a number or literal
+  std::uint64_t ends_atom = 1;
+};
+
+inline bool add_overflow(const std::uint64_t lhs, const std::uint64_t rhs, std::uint64_t& sum)
+{
+  sum = lhs + rhs;
+  return sum < lhs;
+}
+
+inline int first_set_bit(const std::uint64_t mask)
+{
+#if defined(_MSC_VER) and !defined(__clang__)
+  unsigned long index;
+  _BitScanForward64(&index, mask);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctzll(mask);
+#endif
+}
+
+/**
+ * @brief Sets each bit to the XOR of itself and all lower bits, which turns quote positions into string spans
+ */
+inline std::uint64_t prefix_xor(std::uint64_t mask)
+{
+  mask ^= mask << 1;
+  mask ^= mask << 2;
+  mask ^= mask << 4;
+  mask ^= mask << 8;
+  mask ^= mask << 16;
+  mask ^= mask << 32;
+  return mask;
+}
+
+/**
+ * @brief Returns the characters which follow an odd-length run of backslashes, and so are escaped
+ */
+inline std::uint64_t find_escaped(const std::uint64_t backslash, block_state& state)
+{
+  constexpr std::uint64_t even_bits = 0x5555555555555555ULL;
+  constexpr std::uint64_t odd_bits = ~even_bits;
+
+  // Runs which continue from the previous block start on the opposite parity
+  const std::uint64_t start_edges = backslash & ~(backslash << 1);
+  const std::uint64_t even_start_mask = even_bits ^ state.odd_backslashes;
+  const std::uint64_t even_starts = start_edges & even_start_mask;
+  const std::uint64_t odd_starts = start_edges & ~even_start_mask;
+
+  // Adding the start of each run to the run carries one past its end
+  const std::uint64_t even_carries = backslash + even_starts;
+  std::uint64_t odd_carries;
+  const bool ends_odd = add_overflow(backslash, odd_starts, odd_carries);
+  odd_carries |= state.odd_backslashes;
+  state.odd_backslashes = ends_odd ? 1 : 0;
+
+  const std::uint64_t even_start_odd_end = (even_carries & ~backslash) & odd_bits;
+  const std::uint64_t odd_start_even_end = (odd_carries & ~backslash) & even_bits;
+  return even_start_odd_end | odd_start_even_end;
+}
+
+/**
+ * @brief Returns the tokens in a block, given its character classes
+ */
+inline std::uint64_t find_tokens(const block_masks& masks, block_state& state)
+{
+  const std::uint64_t quote = masks.quote & ~find_escaped(masks.backslash, state);
+
+  // Inclusive of opening quotes, exclusive of closing quotes
+  const std::uint64_t in_string = prefix_xor(quote) ^ state.in_string;
+  state.in_string = static_cast<std::uint64_t>(static_cast<std::int64_t>(in_string) >> 63);
+
+  // Numbers and literals start at any other character which follows one of these, outside of strings
+  const std::uint64_t atom_end = masks.op | masks.whitespace | masks.quote;
+  const std::uint64_t atom_start = ~atom_end & ((atom_end << 1) | state.ends_atom);
+  state.ends_atom = atom_end >> 63;
+
+  return ((masks.op | atom_start) & ~in_string) | (quote & in_string);
+}
+
+#ifndef BOOST_ARCHIVE_JSON_STRUCTURAL_INDEX_X86
+
+block_masks classify_scalar(const char* block)
+{
+  block_masks masks{0, 0, 0, 0};
+  for (std::size_t n = 0; n < block_size; ++n)
+  {
+    const std::uint64_t bit = std::uint64_t{1} << n;
+    switch (block[n])
+    {
+    case '\\':
+      masks.backslash |= bit;
+      break;
+    case '"':
+      masks.quote |= bit;
+      break;
+    case '{':
+    case '}':
+    case '[':
+    case ']':
+    case ':':
+    case ',':
+      masks.op |= bit;
+      break;
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+      masks.whitespace |= bit;
+      break;
+    default:
+      break;
+    }
+  }
+  return masks;
+}
+
+#else
+
+inline std::uint64_t mask_sse2(const __m128i bytes)
+{
+  return static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(bytes)));
+}
+
+// SSE2 is part of the x86-64 baseline, so this needs no runtime check
+block_masks classify_sse2(const char* block)
+{
+  block_masks masks{0, 0, 0, 0};
+  for (std::size_t n = 0; n < block_size; n += 16)
+  {
+    const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + n));
+
+    // '[' and ']' differ from '{' and '}' only in bit 0x20
+    const __m128i folded = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    const __m128i op = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')), _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+      _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(':')), _mm_cmpeq_epi8(chars, _mm_set1_epi8(','))));
+    const __m128i whitespace = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\t'))),
+      _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\r'))));
+
+    masks.backslash |= mask_sse2(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))) << n;
+    masks.quote |= mask_sse2(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"'))) << n;
+    masks.op |= mask_sse2(op) << n;
+    masks.whitespace |= mask_sse2(whitespace) << n;
+  }
+  return masks;
+}
+
+#ifdef BOOST_ARCHIVE_JSON_HAS_AVX2
+
+BOOST_ARCHIVE_JSON_TARGET_AVX2 inline std::uint64_t mask_avx2(const __m256i bytes)
+{
+  return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(bytes)));
+}
+
+BOOST_ARCHIVE_JSON_TARGET_AVX2 block_masks classify_avx2(const char* block)
+{
+  block_masks masks{0, 0, 0, 0};
+  for (std::size_t n = 0; n < block_size; n += 32)
+  {
+    const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + n));
+
+    // '[' and ']' differ from '{' and '}' only in bit 0x20
+    const __m256i folded = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+    const __m256i op = _mm256_or_si256(
+      _mm256_or_si256(
+        _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}'))),
+      _mm256_or_si256(
+        _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(','))));
+    const __m256i whitespace = _mm256_or_si256(
+      _mm256_or_si256(
+        _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\t'))),
+      _mm256_or_si256(
+        _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\r'))));
+
+    masks.backslash |= mask_avx2(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\\'))) << n;
+    masks.quote |= mask_avx2(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('"'))) << n;
+    masks.op |= mask_avx2(op) << n;
+    masks.whitespace |= mask_avx2(whitespace) << n;
+  }
+  return masks;
+}
+
+#endif  // BOOST_ARCHIVE_JSON_HAS_AVX2
+
+#endif  // BOOST_ARCHIVE_JSON_STRUCTURAL_INDEX_X86
+
+using classify_fn = block_masks (*)(const char*);
+
+/**
+ * @brief Character classifier for the best instruction set supported by the running CPU
+ */
+classify_fn select_classify()
+{
+#ifdef BOOST_ARCHIVE_JSON_STRUCTURAL_INDEX_X86
+#ifdef BOOST_ARCHIVE_JSON_HAS_AVX2
+  if (__builtin_cpu_supports("avx2"))
+  {
+    return classify_avx2;
+  }
+#endif  // BOOST_ARCHIVE_JSON_HAS_AVX2
+  return classify_sse2;
+#else
+  return classify_scalar;
+#endif  // BOOST_ARCHIVE_JSON_STRUCTURAL_INDEX_X86
+}
+
+}  // namespace
+
+json_structural_index::json_structural_index(const char* data, const std::size_t size)
+{
+  static const classify_fn classify = select_classify();
+
+  // Most documents have about one token for every four to eight characters
+  offsets_.resize(std::max<std::size_t>(size / 4, block_size));
+  std::size_t count = 0;
+
+  block_state state;
+  const auto index_block = [&](const char* block, const std::uint32_t base) {
+    std::uint64_t tokens = find_tokens(classify(block), state);
+    if (offsets_.size() - count < block_size)
+    {
+      offsets_.resize(offsets_.size() * 2);
+    }
+    for (; tokens != 0; tokens &= tokens - 1)
+    {
+      offsets_[count++] = base + static_cast<std::uint32_t>(first_set_bit(tokens));
+    }
+  };
+
+  std::size_t n = 0;
+  for (; n + block_size <= size; n += block_size)
+  {
+    index_block(data + n, static_cast<std::uint32_t>(n));
+  }
+
+  // Whitespace never starts a token, so the last partial block is padded with it
+  if (n < size)
+  {
+    char block[block_size];
+    std::memset(block, ' ', block_size);
+    std::memcpy(block, data + n, size - n);
+    index_block(block, static_cast<std::uint32_t>(n));
+  }
+
+  offsets_.resize(count);
+}
+
+}  // namespace archive
+}  // namespace boost
@@ -0,0 +1,801 @@
+// C++ Standard Library
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <limits>
+#include <system_error>
+#include <sstream>
+#include <stdexcept>
+
+// Boost Archive JSON
+#include <boost/archive/json_string_scan.h>
+#include <boost/archive/json_tokenizer.h>
+
+namespace boost
+{
+namespace archive
+{
+namespace
+{
+
+constexpr std::size_t read_chunk_size = 1 << 16;
+
+/// Arrays are split between threads only where each thread gets at least this many elements
+constexpr std::size_t parallel_min_elements = 1024;
+
+inline bool is_whitespace(const int c) { return c == ' ' or c == '\t' or c == '\n' or c == '\r'; }
+
+inline bool is_number_char(const int c)
+{
+  return ('0' <= c and c <= '9') or c == '-' or c == '+' or c == '.' or c == 'e' or c == 'E';
+}
+
+inline int hex_value(const int c)
+{
+  if ('0' <= c and c <= '9')
+  {
+    return c - '0';
+  }
+  else if ('a' <= c and c <= 'f')
+  {
+    return c - 'a' + 10;
+  }
+  else if ('A' <= c and c <= 'F')
+  {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+inline void append_utf8(std::string& out, const unsigned code_point)
+{
+  if (code_point < 0x80)
+  {
+    out.push_back(static_cast<char>(code_point));
+  }
+  else if (code_point < 0x800)
+  {
+    out.push_back(static_cast<char>(0xc0 | (code_point >> 6)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3f)));
+  }
+  else if (code_point < 0x10000)
+  {
+    out.push_back(static_cast<char>(0xe0 | (code_point >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3f)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3f)));
+  }
+  else
+  {
+    out.push_back(static_cast<char>(0xf0 | (code_point >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3f)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3f)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3f)));
+  }
+}
+
+std::errc parse_number(const char* const first, const char* const last, json_value& out)
+{
+  if (first == last)
+  {
+    return std::errc::invalid_argument;
+  }
+
+  // Negative zero is written as "-0" by the shortest round-trip formatting, and keeps its sign only as a double
+  const bool negative_zero = (last - first == 2 and first[0] == '-' and first[1] == '0');
+  if (!negative_zero and
+      std::find_if(first, last, [](const char c) { return c == '.' or c == 'e' or c == 'E'; }) == last)
+  {
+    if (*first == '-')
+    {
+      std::int64_t value;
+      if (const auto result = std::from_chars(first, last, value); result.ec == std::errc{} and result.ptr == last)
+      {
+        out = json_value{value};
+        return std::errc{};
+      }
+    }
+    else
+    {
+      std::uint64_t value;
+      if (const auto result = std::from_chars(first, last, value); result.ec == std::errc{} and result.ptr == last)
+      {
+        if (value <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+        {
+          out = json_value{static_cast<std::int64_t>(value)};
+        }
+        else
+        {
+          out = json_value{value};
+        }
+        return std::errc{};
+      }
+    }
+    // Integers which do not fit in 64 bits are read as doubles
+  }
+
+  // Locale-independent, correctly rounded conversion
+  double value;
+  const auto result = std::from_chars(first, last, value);
+  if (result.ec != std::errc{})
+  {
+    return result.ec;
+  }
+  else if (result.ptr != last)
+  {
+    return std::errc::invalid_argument;
+  }
+  out = json_value{value};
+  return std::errc{};
+}
+
+}  // namespace
+
+json_tokenizer::json_tokenizer(std::istream& is) :
+    is_{std::addressof(is)},
+    file_{},
+    buffer_(read_chunk_size),
+    begin_{buffer_.data()},
+    pos_{begin_},
+    end_{begin_},
+    offset_{0}
+{}
+
+json_tokenizer::json_tokenizer(const char* data, const std::size_t size, const std::size_t offset) :
+    is_{nullptr},
+    file_{},
+    buffer_{},
+    begin_{data},
+    pos_{data},
+    end_{data + size},
+    offset_{offset}
+{}
+
+json_tokenizer::json_tokenizer(json_mapped_file file) :
+    is_{nullptr},
+    file_{std::move(file)},
+    buffer_{},
+    begin_{file_->data()},
+    pos_{begin_},
+    end_{begin_ + file_->size()},
+    offset_{0}
+{}
+
+bool json_tokenizer::fill()
+{
+  if (is_ == nullptr)
+  {
+    return false;
+  }
+
+  offset_ += static_cast<std::size_t>(end_ - begin_);
+  const auto n_read = is_->rdbuf()->sgetn(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  pos_ = begin_;
+  end_ = begin_ + (n_read > 0 ? n_read : 0);
+  return pos_ != end_;
+}
+
+int json_tokenizer::peek_token()
+{
+  while (true)
+  {
+    while (pos_ != end_ and is_whitespace(*pos_))
+    {
+      ++pos_;
+    }
+    if (pos_ != end_)
+    {
+      return static_cast<unsigned char>(*pos_);
+    }
+    else if (!fill())
+    {
+      return EOF;
+    }
+  }
+}
+
+int json_tokenizer::next_char()
+{
+  if (pos_ == end_ and !fill())
+  {
+    return EOF;
+  }
+  return static_cast<unsigned char>(*pos_++);
+}
+
+void json_tokenizer::expect(const char c)
+{
+  if (peek_token() != c)
+  {
+    char what[] = "Expected ' '";
+    what[10] = c;
+    error(what);
+  }
+  ++pos_;
+}
+
+void json_tokenizer::read_string(std::string* out)
+{
+  // Opening quote
+  ++pos_;
+
+  while (true)
+  {
+    if (pos_ == end_ and !fill())
+    {
+      error("Unterminated string");
+    }
+
+    const char* run = pos_;
+    pos_ = find_json_string_special(pos_, end_);
+    if (out != nullptr)
+    {
+      out->append(run, pos_);
+    }
+
+    if (pos_ == end_)
+    {
+      continue;
+    }
+    else if (*pos_++ == '"')
+    {
+      return;
+    }
+
+    const int escaped = next_char();
+    char unescaped;
+    switch (escaped)
+    {
+    case '"':
+      unescaped = '"';
+      break;
+    case '\\':
+      unescaped = '\\';
+      break;
+    case '/':
+      unescaped = '/';
+      break;
+    case 'b':
+      unescaped = '\b';
+      break;
+    case 'f':
+      unescaped = '\f';
+      break;
+    case 'n':
+      unescaped = '\n';
+      break;
+    case 'r':
+      unescaped = '\r';
+      break;
+    case 't':
+      unescaped = '\t';
+      break;
+    case 'u': {
+      const auto read_code_unit = [this] {
+        unsigned code_unit = 0;
+        for (int n = 0; n < 4; ++n)
+        {
+          const int digit = hex_value(next_char());
+          if (digit < 0)
+          {
+            error("Invalid unicode escape");
+          }
+          code_unit = (code_unit << 4) | static_cast<unsigned>(digit);
+        }
+        return code_unit;
+      };
+
+      unsigned code_point = read_code_unit();
+      if (0xdc00 <= code_point and code_point <= 0xdfff)
+      {
+        error("Invalid unicode escape");
+      }
+      else if (0xd800 <= code_point and code_point <= 0xdbff)
+      {
+        if (next_char() != '\\' or next_char() != 'u')
+        {
+          error("Invalid unicode escape");
+        }
+        const unsigned low = read_code_unit();
+        if (low < 0xdc00 or 0xdfff < low)
+        {
+          error("Invalid unicode escape");
+        }
+        code_point = 0x10000 + (((code_point - 0xd800) << 10) | (low - 0xdc00));
+      }
+      if (out != nullptr)
+      {
+        append_utf8(*out, code_point);
+      }
+      continue;
+    }
+    default:
+      error("Invalid escape sequence");
+    }
+
+    if (out != nullptr)
+    {
+      out->push_back(unescaped);
+    }
+  }
+}
+
+std::string_view json_tokenizer::read_string_view(std::string& scratch)
+{
+  // Refer to the input directly when the whole string is already buffered and needs no unescaping
+  if (const char* p = find_json_string_special(pos_ + 1, end_); p != end_ and *p == '"')
+  {
+    const std::string_view view{pos_ + 1, static_cast<std::size_t>(p - pos_ - 1)};
+    pos_ = p + 1;
+    return view;
+  }
+
+  scratch.clear();
+  read_string(std::addressof(scratch));
+  return scratch;
+}
+
+void json_tokenizer::read_number(json_value& out)
+{
+  const char* first = pos_;
+  const char* last = pos_;
+  while (last != end_ and is_number_char(*last))
+  {
+    ++last;
+  }
+  pos_ = last;
+
+  // Parse in place when the whole token is already buffered, and from a copy when it spans chunks
+  if (last == end_ and is_ != nullptr)
+  {
+    number_.assign(first, last);
+    while ((pos_ != end_ or fill()) and is_number_char(*pos_))
+    {
+      number_.push_back(*pos_++);
+    }
+    first = number_.data();
+    last = first + number_.size();
+  }
+
+  const std::errc ec = parse_number(first, last, out);
+  if (ec == std::errc::result_out_of_range)
+  {
+    error("Number is out of range");
+  }
+  else if (ec != std::errc{})
+  {
+    error("Invalid number");
+  }
+}
+
+void json_tokenizer::read_literal(const char* literal)
+{
+  if (const std::size_t size = std::strlen(literal);
+      static_cast<std::size_t>(end_ - pos_) >= size and std::memcmp(pos_, literal, size) == 0)
+  {
+    pos_ += size;
+    return;
+  }
+
+  for (const char* c = literal; *c != '\0'; ++c)
+  {
+    if (next_char() != *c)
+    {
+      error("Invalid literal");
+    }
+  }
+}
+
+bool json_tokenizer::read_bool()
+{
+  const int c = peek_token();
+  if (c == 't')
+  {
+    read_literal("true");
+  }
+  else if (c == 'f')
+  {
+    read_literal("false");
+  }
+  else
+  {
+    error("Expected boolean value");
+  }
+  return c == 't';
+}
+
+void json_tokenizer::parse_value(json_value& out, std::pmr::memory_resource* resource)
+{
+  parse_value(out, resource, std::numeric_limits<std::size_t>::max());
+}
+
+void json_tokenizer::parse_shallow_value(json_value& out, std::pmr::memory_resource* resource)
+{
+  parse_value(out, resource, 1);
+}
+
+void json_tokenizer::parse_value(json_value& out, std::pmr::memory_resource* resource, const std::size_t depth)
+{
+  const int c = peek_token();
+  if ((c == '{' or c == '[') and depth == 0)
+  {
+    const char* const first = pos_;
+    skip_value();
+    out = json_value{json_value::deferred{
+      std::string_view{first, static_cast<std::size_t>(pos_ - first)},
+      offset_ + static_cast<std::size_t>(first - begin_)}};
+    return;
+  }
+
+  switch (c)
+  {
+  case '{': {
+    ++pos_;
+    out = json_value{json_value::object{resource}};
+    auto& object = out.get<json_value::object>();
+
+    for (bool first = true; peek_token() != '}'; first = false)
+    {
+      if (!first)
+      {
+        expect(',');
+      }
+      if (peek_token() != '"')
+      {
+        error("Expected object member name");
+      }
+      const std::string_view key = read_string_view(scratch_);
+      auto& member = *object.try_emplace(key).first;
+      expect(':');
+      parse_value(member, resource, depth - 1);
+    }
+    ++pos_;
+    break;
+  }
+  case '[': {
+    ++pos_;
+    out = json_value{json_value::array{resource}};
+    auto& array = out.get<json_value::array>();
+
+    for (bool first = true; peek_token() != ']'; first = false)
+    {
+      if (!first)
+      {
+        expect(',');
+      }
+      array.emplace_back();
+      parse_value(array.back(), resource, depth - 1);
+    }
+    ++pos_;
+    break;
+  }
+  case '"':
+    out = json_value{json_value::string{read_string_view(scratch_), resource}};
+    break;
+  case 't':
+    read_literal("true");
+    out = json_value{true};
+    break;
+  case 'f':
+    read_literal("false");
+    out = json_value{false};
+    break;
+  case 'n':
+    read_literal("null");
+    out = json_value{};
+    break;
+  default:
+    read_number(out);
+    break;
+  }
+}
+
+void json_tokenizer::parse_value(
+  json_value& out,
+  std::pmr::memory_resource* resource,
+  const json_structural_index& index)
+{
+  const std::uint32_t* token = index.begin();
+  parse_indexed_value(out, resource, token, index.end());
+  if (token != index.end())
+  {
+    pos_ = begin_ + *token;
+    error("Unexpected trailing characters");
+  }
+}
+
+void json_tokenizer::parse_parallel_value(
+  json_value& out,
+  std::pmr::memory_resource* resource,
+  const std::vector<std::pmr::memory_resource*>& thread_resources,
+  json_worker_pool& workers)
+{
+  if (peek_token() != '{' or thread_resources.size() < 2)
+  {
+    parse_value(out, resource);
+    return;
+  }
+
+  ++pos_;
+  out = json_value{json_value::object{resource}};
+  auto& object = out.get<json_value::object>();
+
+  for (bool first = true; peek_token() != '}'; first = false)
+  {
+    if (!first)
+    {
+      expect(',');
+    }
+    if (peek_token() != '"')
+    {
+      error("Expected object member name");
+    }
+    const std::string_view key = read_string_view(scratch_);
+    auto& member = *object.try_emplace(key).first;
+    expect(':');
+    if (peek_token() == '[')
+    {
+      parse_parallel_array(member, resource, thread_resources, workers);
+    }
+    else
+    {
+      parse_value(member, resource);
+    }
+  }
+  ++pos_;
+}
+
+void json_tokenizer::parse_parallel_array(
+  json_value& out,
+  std::pmr::memory_resource* resource,
+  const std::vector<std::pmr::memory_resource*>& thread_resources,
+  json_worker_pool& workers)
+{
+  // Find where each element starts, without parsing any of them
+  const char* const array_first = pos_;
+  std::vector<const char*> elements;
+  ++pos_;
+  if (peek_token() != ']')
+  {
+    while (true)
+    {
+      elements.push_back(pos_);
+      skip_value();
+      if (peek_token() == ']')
+      {
+        break;
+      }
+      expect(',');
+      peek_token();
+    }
+  }
+  ++pos_;
+
+  const std::size_t thread_count = std::min(thread_resources.size(), elements.size() / parallel_min_elements);
+  if (thread_count < 2)
+  {
+    pos_ = array_first;
+    parse_value(out, resource);
+    return;
+  }
+
+  out = json_value{json_value::array{resource}};
+  auto& array = out.get<json_value::array>();
+  array.resize(elements.size());
+
+  // Each thread parses its run of elements with its own tokenizer, so that error offsets are relative to the input
+  workers.run(thread_count, [&](const std::size_t t) {
+    json_tokenizer in{begin_, static_cast<std::size_t>(end_ - begin_), offset_};
+    const std::size_t last = elements.size() * (t + 1) / thread_count;
+    for (std::size_t n = elements.size() * t / thread_count; n != last; ++n)
+    {
+      in.pos_ = elements[n];
+      in.parse_value(array[n], thread_resources[t]);
+      if (const int c = in.peek_token(); c != ',' and c != ']')
+      {
+        in.error("Expected ','");
+      }
+    }
+  });
+}
+
+int json_tokenizer::next_token(const std::uint32_t*& token, const std::uint32_t* last)
+{
+  if (token == last)
+  {
+    pos_ = end_;
+    return EOF;
+  }
+  pos_ = begin_ + *token++;
+  return static_cast<unsigned char>(*pos_);
+}
+
+void json_tokenizer::parse_indexed_value(
+  json_value& out,
+  std::pmr::memory_resource* resource,
+  const std::uint32_t*& token,
+  const std::uint32_t* last)
+{
+  switch (next_token(token, last))
+  {
+  case '{': {
+    out = json_value{json_value::object{resource}};
+    auto& object = out.get<json_value::object>();
+
+    if (token != last and begin_[*token] == '}')
+    {
+      next_token(token, last);
+      break;
+    }
+    while (true)
+    {
+      if (next_token(token, last) != '"')
+      {
+        error("Expected object member name");
+      }
+      const std::string_view key = read_string_view(scratch_);
+      auto& member = *object.try_emplace(key).first;
+      if (next_token(token, last) != ':')
+      {
+        error("Expected ':'");
+      }
+      parse_indexed_value(member, resource, token, last);
+
+      const int c = next_token(token, last);
+      if (c == '}')
+      {
+        break;
+      }
+      else if (c != ',')
+      {
+        error("Expected ','");
+      }
+    }
+    break;
+  }
+  case '[': {
+    out = json_value{json_value::array{resource}};
+    auto& array = out.get<json_value::array>();
+
+    if (token != last and begin_[*token] == ']')
+    {
+      next_token(token, last);
+      break;
+    }
+    while (true)
+    {
+      array.emplace_back();
+      parse_indexed_value(array.back(), resource, token, last);
+
+      const int c = next_token(token, last);
+      if (c == ']')
+      {
+        break;
+      }
+      else if (c != ',')
+      {
+        error("Expected ','");
+      }
+    }
+    break;
+  }
+  case '"':
+    out = json_value{json_value::string{read_string_view(scratch_), resource}};
+    break;
+  case ',':
+  case ':':
+  case '}':
+  case ']':
+    error("Expected value");
+  case EOF:
+    error("Unexpected end of input");
+  default: {
+    switch (*pos_)
+    {
+    case 't':
+      read_literal("true");
+      out = json_value{true};
+      break;
+    case 'f':
+      read_literal("false");
+      out = json_value{false};
+      break;
+    case 'n':
+      read_literal("null");
+      out = json_value{};
+      break;
+    default:
+      read_number(out);
+      break;
+    }
+
+    // Numbers and literals are not tokens themselves, so they must be followed by whitespace or the next token
+    const char* const next = (token == last) ? end_ : begin_ + *token;
+    if (pos_ != next and !is_whitespace(*pos_))
+    {
+      error("Unexpected character");
+    }
+    break;
+  }
+  }
+}
+
+void json_tokenizer::skip_value()
+{
+  const int c = peek_token();
+  if (c == '"')
+  {
+    read_string(nullptr);
+    return;
+  }
+  else if (c != '{' and c != '[')
+  {
+    while (pos_ != end_ or fill())
+    {
+      if (*pos_ == ',' or *pos_ == '}' or *pos_ == ']' or is_whitespace(*pos_))
+      {
+        break;
+      }
+      ++pos_;
+    }
+    return;
+  }
+
+  // Match brackets without validating contents
+  const char* const first = pos_;
+  closers_.clear();
+  do
+  {
+    pos_ = find_json_nesting_char(pos_, end_);
+    if (pos_ == end_)
+    {
+      if (!fill())
+      {
+        skip_error(first, "Unexpected end of input");
+      }
+      continue;
+    }
+
+    switch (*pos_)
+    {
+    case '"':
+      read_string(nullptr);
+      continue;
+    case '{':
+      closers_.push_back('}');
+      break;
+    case '[':
+      closers_.push_back(']');
+      break;
+    default:
+      if (*pos_ != closers_.back())
+      {
+        skip_error(first, "Mismatched brackets");
+      }
+      closers_.pop_back();
+      break;
+    }
+    ++pos_;
+  } while (!closers_.empty());
+}
+
+void json_tokenizer::skip_error(const char* first, const char* what)
+{
+  // Input read from a stream may no longer hold the start of the value
+  if (is_ == nullptr)
+  {
+    pos_ = first;
+    json_value discarded;
+    parse_value(discarded, std::pmr::get_default_resource());
+  }
+  error(what);
+}
+
+void json_tokenizer::error(const char* what) const
+{
+  std::ostringstream oss;
+  oss << what << " (at offset " << (offset_ + static_cast<std::size_t>(pos_ - begin_)) << ')';
+  throw std::runtime_error{oss.str()};
+}
+
+}  // namespace archive
+}  // namespace boost
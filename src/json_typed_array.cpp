@@ -0,0 +1,163 @@
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+// Boost Archive JSON
+#include <boost/archive/json_typed_array.h>
+
+namespace boost
+{
+namespace archive
+{
+namespace
+{
+
+constexpr char base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+constexpr std::uint8_t base64_invalid = 0xFF;
+
+struct base64_decode_table
+{
+  std::uint8_t values[256];
+
+  constexpr base64_decode_table() : values{}
+  {
+    for (auto& value : values)
+    {
+      value = base64_invalid;
+    }
+    for (std::uint8_t n = 0; n < 64; ++n)
+    {
+      values[static_cast<unsigned char>(base64_alphabet[n])] = n;
+    }
+  }
+};
+
+constexpr base64_decode_table base64_values{};
+
+inline char host_byte_order()
+{
+  const std::uint16_t probe = 1;
+  std::uint8_t first;
+  std::memcpy(&first, &probe, 1);
+  return (first == 1) ? '<' : '>';
+}
+
+inline std::uint32_t base64_value(const char c)
+{
+  const std::uint8_t value = base64_values.values[static_cast<unsigned char>(c)];
+  if (value == base64_invalid)
+  {
+    throw std::runtime_error{"Invalid base64 data"};
+  }
+  return value;
+}
+
+}  // namespace
+
+std::string typed_array_dtype(const char kind, const std::size_t size)
+{
+  std::string dtype{(size == 1) ? '|' : host_byte_order(), kind};
+  dtype += std::to_string(size);
+  return dtype;
+}
+
+bool typed_array_dtype_swapped(const std::string_view dtype, const char kind, const std::size_t size)
+{
+  const char order = dtype.empty() ? '\0' : dtype.front();
+  if (
+    (order != '<' and order != '>' and order != '|' and order != '=') or
+    dtype.substr(1) != typed_array_dtype(kind, size).substr(1))
+  {
+    throw std::runtime_error{"Typed array dtype does not match element type"};
+  }
+  return size > 1 and (order == '<' or order == '>') and order != host_byte_order();
+}
+
+void byte_swap(void* data, const std::size_t count, const std::size_t size)
+{
+  auto* const bytes = static_cast<unsigned char*>(data);
+  for (std::size_t n = 0; n < count; ++n)
+  {
+    std::reverse(bytes + n * size, bytes + (n + 1) * size);
+  }
+}
+
+std::string encode_base64(const void* data, const std::size_t size)
+{
+  const auto* const in = static_cast<const unsigned char*>(data);
+
+  std::string out((size + 2) / 3 * 4, '=');
+  char* dst = out.data();
+
+  std::size_t n = 0;
+  for (; n + 3 <= size; n += 3, dst += 4)
+  {
+    const std::uint32_t triple = (std::uint32_t{in[n]} << 16) | (std::uint32_t{in[n + 1]} << 8) | in[n + 2];
+    dst[0] = base64_alphabet[(triple >> 18) & 0x3F];
+    dst[1] = base64_alphabet[(triple >> 12) & 0x3F];
+    dst[2] = base64_alphabet[(triple >> 6) & 0x3F];
+    dst[3] = base64_alphabet[triple & 0x3F];
+  }
+
+  if (const std::size_t remaining = size - n; remaining > 0)
+  {
+    const std::uint32_t triple = (std::uint32_t{in[n]} << 16) | ((remaining > 1) ? (std::uint32_t{in[n + 1]} << 8) : 0);
+    dst[0] = base64_alphabet[(triple >> 18) & 0x3F];
+    dst[1] = base64_alphabet[(triple >> 12) & 0x3F];
+    if (remaining > 1)
+    {
+      dst[2] = base64_alphabet[(triple >> 6) & 0x3F];
+    }
+  }
+
+  return out;
+}
+
+std::size_t base64_decoded_size(const char* data, const std::size_t size)
+{
+  if (size % 4 != 0)
+  {
+    throw std::runtime_error{"Invalid base64 data"};
+  }
+  else if (size == 0)
+  {
+    return 0;
+  }
+  const std::size_t padding = (data[size - 1] == '=') + (data[size - 2] == '=');
+  return size / 4 * 3 - padding;
+}
+
+void decode_base64(const char* data, const std::size_t size, void* out)
+{
+  auto* dst = static_cast<unsigned char*>(out);
+  const std::size_t decoded_size = base64_decoded_size(data, size);
+
+  // All complete groups of four characters, except a final group with padding
+  const std::size_t full_size = (decoded_size / 3) * 4;
+  for (std::size_t n = 0; n < full_size; n += 4, dst += 3)
+  {
+    const std::uint32_t triple = (base64_value(data[n]) << 18) | (base64_value(data[n + 1]) << 12) |
+                                 (base64_value(data[n + 2]) << 6) | base64_value(data[n + 3]);
+    dst[0] = static_cast<unsigned char>(triple >> 16);
+    dst[1] = static_cast<unsigned char>(triple >> 8);
+    dst[2] = static_cast<unsigned char>(triple);
+  }
+
+  if (const std::size_t remaining = decoded_size % 3; remaining > 0)
+  {
+    const char* const group = data + full_size;
+    std::uint32_t triple = (base64_value(group[0]) << 18) | (base64_value(group[1]) << 12);
+    dst[0] = static_cast<unsigned char>(triple >> 16);
+    if (remaining > 1)
+    {
+      triple |= base64_value(group[2]) << 6;
+      dst[1] = static_cast<unsigned char>(triple >> 8);
+    }
+  }
+}
+
+}  // namespace archive
+}  // namespace boost
@@ -0,0 +1,488 @@
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Boost Archive JSON
+#include <boost/archive/json_format.h>
+#include <boost/archive/json_value.h>
+
+namespace boost
+{
+namespace archive
+{
+namespace
+{
+
+[[noreturn]] void throw_out_of_range() { throw std::runtime_error{"JSON number is out of range"}; }
+
+template <typename IntegerT> IntegerT integer_from_double(const double value)
+{
+  // Bounds are powers of two, so they are exactly representable
+  constexpr double lower = static_cast<double>(std::numeric_limits<IntegerT>::min());
+  constexpr double upper = 2.0 * static_cast<double>(std::numeric_limits<IntegerT>::max() / 2 + 1);
+  if (!(lower <= value and value < upper))
+  {
+    throw_out_of_range();
+  }
+  return static_cast<IntegerT>(value);
+}
+
+constexpr std::size_t initial_member_capacity = 4;
+
+/// Arrays are split between threads only where each thread gets at least this many elements
+constexpr std::size_t parallel_min_elements = 1024;
+
+struct string_sink
+{
+  std::string* str;
+
+  inline void write(const char* data, const std::size_t size) { str->append(data, size); }
+};
+
+inline std::size_t hash_key(const std::string_view key) { return std::hash<std::string_view>{}(key); }
+
+}  // namespace
+
+json_object::json_object(std::pmr::memory_resource* resource) : members_{resource}, index_{nullptr} {}
+
+json_object::json_object(const json_object& other) : members_{other.members_}, index_{nullptr}
+{
+  if (other.index_ != nullptr)
+  {
+    index_rebuild();
+  }
+}
+
+json_object::json_object(json_object&& other) noexcept :
+    members_{std::move(other.members_)},
+    index_{std::exchange(other.index_, nullptr)}
+{}
+
+json_object::~json_object() { index_release(); }
+
+json_object& json_object::operator=(const json_object& other)
+{
+  if (this != std::addressof(other))
+  {
+    index_release();
+    members_ = other.members_;
+    if (other.index_ != nullptr)
+    {
+      index_rebuild();
+    }
+  }
+  return *this;
+}
+
+json_object& json_object::operator=(json_object&& other)
+{
+  if (this != std::addressof(other))
+  {
+    // Members are copied when memory resources differ, so the index is always rebuilt from this object's resource
+    index_release();
+    members_ = std::move(other.members_);
+    if (other.index_ != nullptr)
+    {
+      other.index_release();
+      index_rebuild();
+    }
+  }
+  return *this;
+}
+
+json_value* json_object::find(const std::string_view key)
+{
+  const std::size_t n = position(key);
+  return (n == npos) ? nullptr : std::addressof(members_[n].second);
+}
+
+const json_value* json_object::find(const std::string_view key) const
+{
+  const std::size_t n = position(key);
+  return (n == npos) ? nullptr : std::addressof(members_[n].second);
+}
+
+std::pair<json_value*, bool> json_object::try_emplace(const std::string_view key)
+{
+  if (const std::size_t n = position(key); n != npos)
+  {
+    return {std::addressof(members_[n].second), false};
+  }
+
+  // Most objects are small; start with room for a few members rather than growing one at a time
+  if (members_.empty())
+  {
+    members_.reserve(initial_member_capacity);
+  }
+  members_.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+
+  if (index_ == nullptr)
+  {
+    if (members_.size() > hashed_lookup_threshold)
+    {
+      index_rebuild();
+    }
+  }
+  else if (2 * members_.size() > index_[0])
+  {
+    index_rebuild();
+  }
+  else
+  {
+    index_insert(members_.size() - 1);
+  }
+  return {std::addressof(members_.back().second), true};
+}
+
+json_value& json_object::emplace_back(const std::string_view key)
+{
+  if (members_.empty())
+  {
+    members_.reserve(initial_member_capacity);
+  }
+  members_.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+
+  // Objects without an index are searched linearly, and indexed once try_emplace next appends to them
+  if (index_ == nullptr)
+  {
+    return members_.back().second;
+  }
+  else if (2 * members_.size() > index_[0])
+  {
+    index_rebuild();
+  }
+  else
+  {
+    index_insert(members_.size() - 1);
+  }
+  return members_.back().second;
+}
+
+std::size_t json_object::position(const std::string_view key) const
+{
+  if (index_ == nullptr)
+  {
+    for (std::size_t n = 0; n < members_.size(); ++n)
+    {
+      if (members_[n].first == key)
+      {
+        return n;
+      }
+    }
+    return npos;
+  }
+
+  const std::size_t mask = index_[0] - 1;
+  for (std::size_t slot = hash_key(key) & mask; index_[slot + 1] != 0; slot = (slot + 1) & mask)
+  {
+    const std::size_t n = index_[slot + 1] - 1;
+    if (members_[n].first == key)
+    {
+      return n;
+    }
+  }
+  return npos;
+}
+
+void json_object::index_insert(const std::size_t position)
+{
+  const std::size_t mask = index_[0] - 1;
+  std::size_t slot = hash_key(members_[position].first) & mask;
+  while (index_[slot + 1] != 0)
+  {
+    slot = (slot + 1) & mask;
+  }
+  index_[slot + 1] = static_cast<std::uint32_t>(position + 1);
+}
+
+void json_object::index_rebuild()
+{
+  index_release();
+
+  // Keep load factor at or below one half
+  std::size_t n_slots = 2 * hashed_lookup_threshold;
+  while (n_slots < 4 * members_.size())
+  {
+    n_slots *= 2;
+  }
+
+  auto* const resource = members_.get_allocator().resource();
+  index_ = static_cast<std::uint32_t*>(resource->allocate((n_slots + 1) * sizeof(std::uint32_t), alignof(std::uint32_t)));
+  index_[0] = static_cast<std::uint32_t>(n_slots);
+  std::fill(index_ + 1, index_ + n_slots + 1, 0);
+
+  for (std::size_t n = 0; n < members_.size(); ++n)
+  {
+    index_insert(n);
+  }
+}
+
+void json_object::index_release()
+{
+  if (index_ != nullptr)
+  {
+    members_.get_allocator().resource()->deallocate(
+      index_, (index_[0] + 1) * sizeof(std::uint32_t), alignof(std::uint32_t));
+    index_ = nullptr;
+  }
+}
+
+json_value::json_value(const float value) : data_{value}
+{
+  if (std::isnan(value) or std::isinf(value))
+  {
+    throw std::overflow_error{"JSON does not support non-finite numbers"};
+  }
+}
+
+json_value::json_value(const double value) : data_{value}
+{
+  if (std::isnan(value) or std::isinf(value))
+  {
+    throw std::overflow_error{"JSON does not support non-finite numbers"};
+  }
+}
+
+template <> std::int64_t json_value::to_number<std::int64_t>() const
+{
+  if (const auto* const value = std::get_if<std::int64_t>(&data_); value != nullptr)
+  {
+    return *value;
+  }
+  else if (const auto* const value = std::get_if<std::uint64_t>(&data_); value != nullptr)
+  {
+    if (*value > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+    {
+      throw_out_of_range();
+    }
+    return static_cast<std::int64_t>(*value);
+  }
+  return integer_from_double<std::int64_t>(to_number<double>());
+}
+
+template <> std::uint64_t json_value::to_number<std::uint64_t>() const
+{
+  if (const auto* const value = std::get_if<std::uint64_t>(&data_); value != nullptr)
+  {
+    return *value;
+  }
+  else if (const auto* const value = std::get_if<std::int64_t>(&data_); value != nullptr)
+  {
+    if (*value < 0)
+    {
+      throw_out_of_range();
+    }
+    return static_cast<std::uint64_t>(*value);
+  }
+  return integer_from_double<std::uint64_t>(to_number<double>());
+}
+
+template <> float json_value::to_number<float>() const
+{
+  if (const auto* const value = std::get_if<float>(&data_); value != nullptr)
+  {
+    return *value;
+  }
+
+  const double value = to_number<double>();
+  if (std::fabs(value) > static_cast<double>(std::numeric_limits<float>::max()))
+  {
+    throw_out_of_range();
+  }
+  return static_cast<float>(value);
+}
+
+template <> double json_value::to_number<double>() const
+{
+  if (const auto* const value = std::get_if<double>(&data_); value != nullptr)
+  {
+    return *value;
+  }
+  else if (const auto* const value = std::get_if<float>(&data_); value != nullptr)
+  {
+    return static_cast<double>(*value);
+  }
+  else if (const auto* const value = std::get_if<std::int64_t>(&data_); value != nullptr)
+  {
+    return static_cast<double>(*value);
+  }
+  return static_cast<double>(get<std::uint64_t>());
+}
+
+void json_value::serialize(json_output_buffer& out, const bool prettify, json_worker_pool* workers) const
+{
+  serialize_indented(out, prettify ? 0 : -1, workers);
+}
+
+void json_value::serialize_elements(
+  json_output_buffer& out,
+  const array& arr,
+  const std::size_t first,
+  const std::size_t last,
+  const int indent)
+{
+  for (std::size_t n = first; n != last; ++n)
+  {
+    if (n != 0)
+    {
+      out.put(',');
+    }
+    if (indent != -1)
+    {
+      write_json_indent(out, static_cast<std::size_t>(indent));
+    }
+    arr[n].serialize_indented(out, indent, nullptr);
+  }
+}
+
+void json_value::serialize_elements_parallel(
+  json_output_buffer& out,
+  const array& arr,
+  const int indent,
+  const std::size_t threads,
+  json_worker_pool& workers)
+{
+  const auto run_first = [&arr, threads](const std::size_t t) { return arr.size() * t / threads; };
+
+  std::vector<std::string> runs(threads);
+  workers.run(threads, [&](const std::size_t t) {
+    // The first run goes straight to the output
+    if (t == 0)
+    {
+      serialize_elements(out, arr, 0, run_first(1), indent);
+      return;
+    }
+    string_sink sink{std::addressof(runs[t])};
+    json_output_buffer run_out{sink};
+    serialize_elements(run_out, arr, run_first(t), run_first(t + 1), indent);
+    run_out.flush();
+  });
+
+  for (std::size_t t = 1; t < threads; ++t)
+  {
+    out.write(runs[t].data(), runs[t].size());
+  }
+}
+
+void json_value::serialize_indented(json_output_buffer& out, int indent, json_worker_pool* workers) const
+{
+  // Same layout as picojson::value::serialize
+  switch (data_.index())
+  {
+  case 0:
+    out.write("null", 4);
+    break;
+  case 1:
+    if (std::get<bool>(data_))
+    {
+      out.write("true", 4);
+    }
+    else
+    {
+      out.write("false", 5);
+    }
+    break;
+  case 2:
+    write_json_number(out, std::get<std::int64_t>(data_));
+    break;
+  case 3:
+    write_json_number(out, std::get<std::uint64_t>(data_));
+    break;
+  case 4:
+    write_json_number(out, std::get<float>(data_));
+    break;
+  case 5:
+    write_json_number(out, std::get<double>(data_));
+    break;
+  case 6: {
+    const auto& str = std::get<string>(data_);
+    write_json_string(out, str.data(), str.size());
+    break;
+  }
+  case 7: {
+    const auto& arr = std::get<array>(data_);
+    out.put('[');
+    if (indent != -1)
+    {
+      ++indent;
+    }
+    if (const std::size_t run_count =
+          (workers == nullptr) ? 1 : std::min(workers->size(), arr.size() / parallel_min_elements);
+        run_count > 1)
+    {
+      serialize_elements_parallel(out, arr, indent, run_count, *workers);
+    }
+    else
+    {
+      serialize_elements(out, arr, 0, arr.size(), indent);
+    }
+    if (indent != -1)
+    {
+      --indent;
+      if (!arr.empty())
+      {
+        write_json_indent(out, static_cast<std::size_t>(indent));
+      }
+    }
+    out.put(']');
+    break;
+  }
+  case 8: {
+    const auto& obj = std::get<object>(data_);
+    out.put('{');
+    if (indent != -1)
+    {
+      ++indent;
+    }
+    for (auto itr = obj.begin(); itr != obj.end(); ++itr)
+    {
+      if (itr != obj.begin())
+      {
+        out.put(',');
+      }
+      if (indent != -1)
+      {
+        write_json_indent(out, static_cast<std::size_t>(indent));
+      }
+      write_json_string(out, itr->first.data(), itr->first.size());
+      out.put(':');
+      if (indent != -1)
+      {
+        out.put(' ');
+      }
+      itr->second.serialize_indented(out, indent, workers);
+    }
+    if (indent != -1)
+    {
+      --indent;
+      if (!obj.empty())
+      {
+        write_json_indent(out, static_cast<std::size_t>(indent));
+      }
+    }
+    out.put('}');
+    break;
+  }
+  case 9: {
+    const auto& text = std::get<deferred>(data_).text;
+    out.write(text.data(), text.size());
+    break;
+  }
+  }
+
+  if (indent == 0)
+  {
+    out.put('\n');
+  }
+}
+
+}  // namespace archive
+}  // namespace boost
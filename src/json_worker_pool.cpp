@@ -0,0 +1,137 @@
+// C++ Standard Library
+#include <memory>
+#include <stdexcept>
+
+// Boost Archive JSON
+#include <boost/archive/json_worker_pool.h>
+
+namespace boost
+{
+namespace archive
+{
+
+json_worker_pool::json_worker_pool()
+{
+  const std::size_t hardware_threads = std::thread::hardware_concurrency();
+  if (hardware_threads < 2)
+  {
+    return;
+  }
+
+  workers_.reserve(hardware_threads - 1);
+  try
+  {
+    for (std::size_t index = 1; index < hardware_threads; ++index)
+    {
+      workers_.emplace_back(&json_worker_pool::work, this, index);
+    }
+  }
+  catch (...)
+  {
+    stop();
+    throw;
+  }
+}
+
+json_worker_pool::~json_worker_pool() { stop(); }
+
+void json_worker_pool::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    stopping_ = true;
+  }
+  started_.notify_all();
+  for (auto& worker : workers_)
+  {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+void json_worker_pool::run(const std::size_t count, const std::function<void(std::size_t)>& task)
+{
+  if (count > size())
+  {
+    throw std::logic_error{"JSON worker pool has fewer threads than runs"};
+  }
+  else if (count < 2)
+  {
+    if (count == 1)
+    {
+      task(0);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    task_ = std::addressof(task);
+    count_ = count;
+    n_running_ = count - 1;
+    errors_.assign(count, nullptr);
+    ++generation_;
+  }
+  started_.notify_all();
+
+  // Each index stores its own error, so they are not written under the lock
+  try
+  {
+    task(0);
+  }
+  catch (...)
+  {
+    errors_[0] = std::current_exception();
+  }
+
+  std::unique_lock<std::mutex> lock{mutex_};
+  finished_.wait(lock, [this] { return n_running_ == 0; });
+  task_ = nullptr;
+  for (const auto& error : errors_)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+void json_worker_pool::work(const std::size_t index)
+{
+  std::size_t generation = 0;
+  std::unique_lock<std::mutex> lock{mutex_};
+  while (true)
+  {
+    started_.wait(lock, [this, &generation] { return stopping_ or generation_ != generation; });
+    if (stopping_)
+    {
+      return;
+    }
+
+    generation = generation_;
+    if (index >= count_)
+    {
+      continue;
+    }
+
+    const auto& task = *task_;
+    lock.unlock();
+    try
+    {
+      task(index);
+    }
+    catch (...)
+    {
+      errors_[index] = std::current_exception();
+    }
+    lock.lock();
+
+    if (--n_running_ == 0)
+    {
+      finished_.notify_one();
+    }
+  }
+}
+
+}  // namespace archive
+}  // namespace boost
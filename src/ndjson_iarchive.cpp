@@ -0,0 +1,41 @@
+// C++ Standard Library
+#include <stdexcept>
+
+// Boost
+#include <boost/archive/detail/archive_serializer_map.hpp>
+#include <boost/archive/impl/archive_serializer_map.ipp>
+
+// Boost Archive JSON
+#include <boost/archive/ndjson_iarchive.h>
+
+namespace boost
+{
+namespace archive
+{
+
+ndjson_iarchive::ndjson_iarchive(std::istream& is) : basic_json_iarchive<ndjson_iarchive, json_stream_reader>{0, is} {}
+
+ndjson_iarchive::ndjson_iarchive(const char* data, const std::size_t size) :
+    basic_json_iarchive<ndjson_iarchive, json_stream_reader>{0, data, size}
+{}
+
+ndjson_iarchive::ndjson_iarchive(const std::filesystem::path& path) :
+    basic_json_iarchive<ndjson_iarchive, json_stream_reader>{0, json_mapped_file{path}}
+{}
+
+bool ndjson_iarchive::next_record()
+{
+  try
+  {
+    return json_.next_record();
+  }
+  catch (const std::runtime_error& err)
+  {
+    throw json_archive_exception{err.what()};
+  }
+}
+
+template class detail::archive_serializer_map<ndjson_iarchive>;
+
+}  // namespace archive
+}  // namespace boost
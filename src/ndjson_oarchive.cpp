@@ -0,0 +1,34 @@
+// Boost
+#include <boost/archive/detail/archive_serializer_map.hpp>
+#include <boost/archive/impl/archive_serializer_map.ipp>
+
+// Boost Archive JSON
+#include <boost/archive/ndjson_oarchive.h>
+
+namespace boost
+{
+namespace archive
+{
+
+ndjson_oarchive::ndjson_oarchive(std::ostream& os, const bool record_per_value, const unsigned int flags) :
+    basic_json_oarchive<ndjson_oarchive, json_stream_writer>{flags, os, false, true},
+    record_per_value_{record_per_value}
+{}
+
+ndjson_oarchive::~ndjson_oarchive()
+{
+  // A save which threw may have left the record open; it is closed so that every line is still a JSON object
+  try
+  {
+    json_.finish_record();
+  }
+  catch (...)
+  {
+    // Destructors must not throw, so output which could not be written is dropped
+  }
+}
+
+template class detail::archive_serializer_map<ndjson_oarchive>;
+
+}  // namespace archive
+}  // namespace boost
@@ -1,14 +1,35 @@
 
 // C++ Standard Library
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <forward_list>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
 // GTest
 #include <gtest/gtest.h>
 
+// Boost
+#include <boost/serialization/unique_ptr.hpp>
+
 // Boost Archive JSON
 #include <boost/archive/json_iarchive.h>
+#include <boost/archive/json_oarchive.h>
 
 class json_iarchive_test_suite : public ::testing::Test
 {
@@ -48,6 +69,66 @@ public:
     }
   };
 
+  struct VersionedTestStruct
+  {
+    unsigned int file_version = 0;
+    int m = 0;
+
+    VersionedTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      this->file_version = file_version;
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  /// Only ever serialized through pointers, which makes Boost track objects of this type
+  struct PointeeTestStruct
+  {
+    int m = 111;
+
+    PointeeTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  /// Nested one level deeper with each node
+  struct ListTestStruct
+  {
+    int m = 0;
+    std::unique_ptr<ListTestStruct> next;
+
+    ListTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+      ar& BOOST_SERIALIZATION_NVP(next);
+    }
+  };
+
+  struct CountingResource : std::pmr::memory_resource
+  {
+    std::size_t n_allocations = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      ++n_allocations;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+      std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+  };
+
   void create_iarchive(const char* serialized)
   {
     buffer << serialized;
@@ -120,6 +201,55 @@ TEST_F(json_iarchive_test_suite, DeserializeDouble)
   ASSERT_EQ(value, 123.456);
 }
 
+TEST_F(json_iarchive_test_suite, DeserializeShortestRoundTrip)
+{
+  static const char* SERIALIZED = "{\"float\":0.1,\"double\":0.30000000000000004,\"large\":1e+300}";
+  this->create_iarchive(SERIALIZED);
+
+  float float_value;
+  double double_value;
+  double large_value;
+  ((*ar) & boost::serialization::make_nvp("float", float_value));
+  ((*ar) & boost::serialization::make_nvp("double", double_value));
+  ((*ar) & boost::serialization::make_nvp("large", large_value));
+
+  ASSERT_EQ(float_value, 0.1f);
+  ASSERT_EQ(double_value, 0.1 + 0.2);
+  ASSERT_EQ(large_value, 1e300);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeNegativeZeroRoundTrip)
+{
+  std::ostringstream os;
+  {
+    boost::archive::json_oarchive oar{os};
+    const float float_value = -0.0f;
+    const double double_value = -0.0;
+    oar << boost::serialization::make_nvp("float", float_value);
+    oar << boost::serialization::make_nvp("double", double_value);
+  }
+  this->create_iarchive(os.str().c_str());
+
+  float float_value = 1.0f;
+  double double_value = 1.0;
+  int int_value = 1;
+  ((*ar) & boost::serialization::make_nvp("float", float_value));
+  ((*ar) & boost::serialization::make_nvp("double", double_value));
+  ((*ar) & boost::serialization::make_nvp("double", int_value));
+
+  ASSERT_EQ(float_value, 0.0f);
+  ASSERT_TRUE(std::signbit(float_value));
+  ASSERT_EQ(double_value, 0.0);
+  ASSERT_TRUE(std::signbit(double_value));
+  ASSERT_EQ(int_value, 0);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnNumberOutOfRange)
+{
+  static const char* SERIALIZED = "{\"double\":1e400}";
+  ASSERT_THROW(this->create_iarchive(SERIALIZED), boost::archive::json_archive_exception);
+}
+
 TEST_F(json_iarchive_test_suite, DeserializeInt)
 {
   static const char* SERIALIZED = "{\"int\":99}";
@@ -131,6 +261,52 @@ TEST_F(json_iarchive_test_suite, DeserializeInt)
   ASSERT_EQ(value, 99);
 }
 
+TEST_F(json_iarchive_test_suite, DeserializeInt64)
+{
+  static const char* SERIALIZED = "{\"max\":9223372036854775807,\"min\":-9223372036854775808}";
+  this->create_iarchive(SERIALIZED);
+
+  std::int64_t max_value;
+  std::int64_t min_value;
+  ((*ar) & boost::serialization::make_nvp("max", max_value));
+  ((*ar) & boost::serialization::make_nvp("min", min_value));
+
+  ASSERT_EQ(max_value, std::numeric_limits<std::int64_t>::max());
+  ASSERT_EQ(min_value, std::numeric_limits<std::int64_t>::min());
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeUInt64)
+{
+  static const char* SERIALIZED = "{\"uint64\":18446744073709551615,\"large\":9007199254740993}";
+  this->create_iarchive(SERIALIZED);
+
+  std::uint64_t value;
+  unsigned long long large_value;
+  ((*ar) & boost::serialization::make_nvp("uint64", value));
+  ((*ar) & boost::serialization::make_nvp("large", large_value));
+
+  ASSERT_EQ(value, std::numeric_limits<std::uint64_t>::max());
+  ASSERT_EQ(large_value, 9007199254740993ULL);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnIntegerOutOfRange)
+{
+  static const char* SERIALIZED = "{\"short\":40000,\"unsigned\":-1}";
+  this->create_iarchive(SERIALIZED);
+
+  short short_value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("short", short_value)),
+    boost::archive::json_archive_exception
+  );
+
+  unsigned unsigned_value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("unsigned", unsigned_value)),
+    boost::archive::json_archive_exception
+  );
+}
+
 TEST_F(json_iarchive_test_suite, DeserializeString)
 {
   static const char* SERIALIZED = "{\"string\":\"hello\"}";
@@ -142,6 +318,33 @@ TEST_F(json_iarchive_test_suite, DeserializeString)
   ASSERT_EQ(value, "hello");
 }
 
+TEST_F(json_iarchive_test_suite, DeserializeLongEscapedString)
+{
+  // Escape sequences on both sides of each 16- and 32-character block boundary
+  std::string serialized = "{\"string\":\"";
+  std::string expected;
+  for (int n = 0; n < 100; ++n)
+  {
+    if (n % 16 == 0 or n % 16 == 15)
+    {
+      serialized += (n % 32 == 0) ? "\\\"" : "\\\\";
+      expected += (n % 32 == 0) ? '"' : '\\';
+    }
+    else
+    {
+      serialized += static_cast<char>('a' + n % 26);
+      expected += static_cast<char>('a' + n % 26);
+    }
+  }
+  serialized += "\"}";
+  this->create_iarchive(serialized.c_str());
+
+  std::string value;
+  ((*ar) & boost::serialization::make_nvp("string", value));
+
+  ASSERT_EQ(value, expected);
+}
+
 TEST_F(json_iarchive_test_suite, DeserializeStruct)
 {
   // clang-format off
@@ -192,6 +395,111 @@ TEST_F(json_iarchive_test_suite, DeserializeNestedStruct)
   ASSERT_EQ(value, NestedTestStruct{});
 }
 
+TEST_F(json_iarchive_test_suite, DeserializeVersion)
+{
+  static const char* SERIALIZED = "{\"struct\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":3,\"m\":111}}";
+  this->create_iarchive(SERIALIZED);
+
+  VersionedTestStruct value;
+  ((*ar) & boost::serialization::make_nvp("struct", value));
+
+  ASSERT_EQ(value.file_version, 3U);
+  ASSERT_EQ(value.m, 111);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializePointer)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"ptr\":{"
+        "\"_class_id_optional\":0,"
+        "\"_tracking\":false,"
+        "\"_version\":0,"
+        "\"tx\":{"
+          "\"_class_id\":1,"
+          "\"_tracking\":true,"
+          "\"_version\":0,"
+          "\"_object_id\":0,"
+          "\"m\":222"
+        "}"
+      "},"
+      "\"alias\":{\"_class_id_reference\":1,\"_object_reference\":0},"
+      "\"null\":{\"tx\":{\"_class_id\":-1}}"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::unique_ptr<PointeeTestStruct> ptr_value;
+  PointeeTestStruct* alias_value = nullptr;
+  std::unique_ptr<PointeeTestStruct> null_value{new PointeeTestStruct};
+  ((*ar) & boost::serialization::make_nvp("ptr", ptr_value));
+  ((*ar) & boost::serialization::make_nvp("alias", alias_value));
+  ((*ar) & boost::serialization::make_nvp("null", null_value));
+
+  ASSERT_NE(ptr_value, nullptr);
+  ASSERT_EQ(ptr_value->m, 222);
+  ASSERT_EQ(alias_value, ptr_value.get());
+  ASSERT_EQ(null_value, nullptr);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeCompactMetadata)
+{
+  // As saved with json_compact_metadata; missing class information is loaded as untracked, at version 0
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct_array\":[{\"m\":111},{\"m\":222}],"
+      "\"ptr\":{"
+        "\"tx\":{"
+          "\"_class_id\":2,"
+          "\"_tracking\":true,"
+          "\"_version\":0,"
+          "\"_object_id\":0,"
+          "\"m\":333"
+        "}"
+      "}"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<TestStruct> struct_array_value;
+  std::unique_ptr<PointeeTestStruct> ptr_value;
+  ((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+  ((*ar) & boost::serialization::make_nvp("ptr", ptr_value));
+
+  ASSERT_EQ(struct_array_value.size(), 2UL);
+  ASSERT_EQ(struct_array_value[0].m, 111);
+  ASSERT_EQ(struct_array_value[1].m, 222);
+  ASSERT_NE(ptr_value, nullptr);
+  ASSERT_EQ(ptr_value->m, 333);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeDeeplyNested)
+{
+  // Nested deeper than the active values which are tracked without allocating
+  std::string serialized =
+    "{\"list\":{\"_class_id_optional\":0,\"_tracking\":true,\"_version\":0,\"_object_id\":0,\"m\":0,"
+    "\"next\":{\"_class_id_optional\":1,\"_tracking\":false,\"_version\":0,\"tx\":";
+  for (int n = 1; n < 32; ++n)
+  {
+    const std::string id = std::to_string(n);
+    serialized += "{\"_class_id_reference\":0,\"_object_id\":" + id + ",\"m\":" + id + ",\"next\":{\"tx\":";
+  }
+  serialized += "{\"_class_id\":-1}" + std::string(2 * 32 + 1, '}');
+  this->create_iarchive(serialized.c_str());
+
+  ListTestStruct value;
+  ((*ar) & boost::serialization::make_nvp("list", value));
+
+  int n = 0;
+  for (const ListTestStruct* node = &value; node != nullptr; node = node->next.get())
+  {
+    ASSERT_EQ(node->m, n++);
+  }
+  ASSERT_EQ(n, 32);
+}
+
 TEST_F(json_iarchive_test_suite, DeserializeBoolStdVector)
 {
   static const char* SERIALIZED = "{\"bool_array\":[true,false,true,false]}";
@@ -204,6 +512,26 @@ TEST_F(json_iarchive_test_suite, DeserializeBoolStdVector)
   ASSERT_EQ(value, bool_array_value_target);
 }
 
+TEST_F(json_iarchive_test_suite, DeserializeBoolStdBitset)
+{
+  static const char* SERIALIZED = "{\"bitset\":[true,false,true,false]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::bitset<4> value;
+  ((*ar) & boost::serialization::make_nvp("bitset", value));
+
+  ASSERT_EQ(value.to_string(), "0101");
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnTooManyBits)
+{
+  static const char* SERIALIZED = "{\"bitset\":[true,false,true,false,true]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::bitset<4> value;
+  ASSERT_THROW(((*ar) & boost::serialization::make_nvp("bitset", value)), boost::archive::json_archive_exception);
+}
+
 TEST_F(json_iarchive_test_suite, DeserializeIntStdVector)
 {
   static const char* SERIALIZED = "{\"int_array\":[1,2,3,4]}";
@@ -272,6 +600,94 @@ TEST_F(json_iarchive_test_suite, DeserializeStructStdVector)
   ASSERT_EQ(value, struct_array_value_target);
 }
 
+TEST_F(json_iarchive_test_suite, DeserializeFloatStdVectorBinary)
+{
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\"<f4\",\"shape\":[2],\"data\":\"AADAPwAAAMA=\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<float> value;
+  ((*ar) & boost::serialization::make_nvp("float_array", value));
+
+  const std::vector<float> float_array_value_target{1.5f, -2.0f};
+  ASSERT_EQ(value, float_array_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeSwappedFloatStdArrayBinary)
+{
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\">f4\",\"shape\":[2],\"data\":\"P8AAAMAAAAA=\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::array<float, 2> value;
+  ((*ar) & boost::serialization::make_nvp("float_array", value));
+
+  const std::array<float, 2> float_array_value_target{1.5f, -2.0f};
+  ASSERT_EQ(value, float_array_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeShortStdVectorBinary)
+{
+  static const char* SERIALIZED = "{\"short_array\":{\"dtype\":\"<i2\",\"shape\":[3],\"data\":\"AQD+/ywB\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<short> value;
+  ((*ar) & boost::serialization::make_nvp("short_array", value));
+
+  const std::vector<short> short_array_value_target{1, -2, 300};
+  ASSERT_EQ(value, short_array_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnBinaryDtypeMismatch)
+{
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\"<f8\",\"shape\":[1],\"data\":\"AADAPwAAAMA=\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<float> value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("float_array", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnBinaryShapeMismatch)
+{
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\"<f4\",\"shape\":[3],\"data\":\"AADAPwAAAMA=\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<float> value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("float_array", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnBinaryShapeOverflow)
+{
+  // 2^61 + 1 doubles take 8 bytes once the byte count wraps around
+  static const char* SERIALIZED =
+    "{\"double_array\":{\"dtype\":\"<f8\",\"shape\":[2305843009213693953],\"data\":\"AAAAAAAAAAA=\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<double> value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("double_array", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnBinaryShapeProductOverflow)
+{
+  // 2^63 * 2 elements wrap around to none
+  static const char* SERIALIZED =
+    "{\"double_array\":{\"dtype\":\"<f8\",\"shape\":[9223372036854775808,2],\"data\":\"\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<double> value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("double_array", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
 TEST_F(json_iarchive_test_suite, DeserializeBoolStdArray)
 {
   static const char* SERIALIZED = "{\"bool_array\":[true,false,true,false]}";
@@ -351,3 +767,536 @@ TEST_F(json_iarchive_test_suite, DeserializeStructStdArray)
   const std::array<TestStruct, 2> struct_array_value_target{TestStruct{}, TestStruct{}};
   ASSERT_EQ(value, struct_array_value_target);
 }
+
+TEST_F(json_iarchive_test_suite, DeserializeStringKeyStdMap)
+{
+  static const char* SERIALIZED = "{\"map\":{\"b\":2,\"a\":1,\"quote\\\"d\":3}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::map<std::string, int> value{{"c", 4}};
+  ((*ar) & boost::serialization::make_nvp("map", value));
+
+  const std::map<std::string, int> map_value_target{{"a", 1}, {"b", 2}, {"quote\"d", 3}};
+  ASSERT_EQ(value, map_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeStructStdUnorderedMap)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"map\":{"
+        "\"a\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111},"
+        "\"b\":{\"m\":111}"
+      "}"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::unordered_map<std::string, TestStruct> value;
+  ((*ar) & boost::serialization::make_nvp("map", value));
+
+  const std::unordered_map<std::string, TestStruct> map_value_target{{"a", TestStruct{}}, {"b", TestStruct{}}};
+  ASSERT_EQ(value, map_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeIntKeyStdMap)
+{
+  static const char* SERIALIZED = "{\"map\":[[1,\"one\"],[2,\"two\"]],\"multimap\":[[\"a\",1],[\"a\",2]]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::map<int, std::string> value;
+  std::multimap<std::string, int> multimap_value;
+  ((*ar) & boost::serialization::make_nvp("map", value));
+  ((*ar) & boost::serialization::make_nvp("multimap", multimap_value));
+
+  const std::map<int, std::string> map_value_target{{1, "one"}, {2, "two"}};
+  const std::multimap<std::string, int> multimap_value_target{{"a", 1}, {"a", 2}};
+  ASSERT_EQ(value, map_value_target);
+  ASSERT_EQ(multimap_value, multimap_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnInvalidStdMapPair)
+{
+  static const char* SERIALIZED = "{\"map\":[[1,\"one\",2]]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::map<int, std::string> value;
+  ASSERT_THROW(((*ar) & boost::serialization::make_nvp("map", value)), boost::archive::json_archive_exception);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeStdSequences)
+{
+  static const char* SERIALIZED =
+    "{\"set\":[1,2,3],\"deque\":[1.5,2.5],\"list\":[\"a\",\"b\"],\"forward_list\":[1,2]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::set<int> set_value{4};
+  std::deque<double> deque_value;
+  std::list<std::string> list_value;
+  std::forward_list<int> forward_list_value{3};
+  ((*ar) & boost::serialization::make_nvp("set", set_value));
+  ((*ar) & boost::serialization::make_nvp("deque", deque_value));
+  ((*ar) & boost::serialization::make_nvp("list", list_value));
+  ((*ar) & boost::serialization::make_nvp("forward_list", forward_list_value));
+
+  ASSERT_EQ(set_value, (std::set<int>{1, 2, 3}));
+  ASSERT_EQ(deque_value, (std::deque<double>{1.5, 2.5}));
+  ASSERT_EQ(list_value, (std::list<std::string>{"a", "b"}));
+  ASSERT_EQ(forward_list_value, (std::forward_list<int>{1, 2}));
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeStdOptional)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"empty\":null,"
+      "\"int\":5,"
+      "\"struct_array\":[null,{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111}]"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::optional<int> empty_value{3};
+  std::optional<int> int_value;
+  std::vector<std::optional<TestStruct>> struct_array_value;
+  ((*ar) & boost::serialization::make_nvp("empty", empty_value));
+  ((*ar) & boost::serialization::make_nvp("int", int_value));
+  ((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+
+  ASSERT_FALSE(empty_value.has_value());
+  ASSERT_EQ(int_value, 5);
+  const std::vector<std::optional<TestStruct>> struct_array_value_target{std::nullopt, TestStruct{}};
+  ASSERT_EQ(struct_array_value, struct_array_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeStdVariant)
+{
+  static const char* SERIALIZED = "{\"string\":{\"which\":1,\"value\":\"x\"},\"empty\":{\"which\":0}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::variant<int, std::string> string_value;
+  std::variant<std::monostate, int> empty_value{4};
+  ((*ar) & boost::serialization::make_nvp("string", string_value));
+  ((*ar) & boost::serialization::make_nvp("empty", empty_value));
+
+  ASSERT_EQ(string_value, (std::variant<int, std::string>{std::string{"x"}}));
+  ASSERT_EQ(empty_value.index(), 0UL);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnInvalidVariantIndex)
+{
+  static const char* SERIALIZED = "{\"variant\":{\"which\":2,\"value\":1}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::variant<int, std::string> value;
+  ASSERT_THROW(((*ar) & boost::serialization::make_nvp("variant", value)), boost::archive::json_archive_exception);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeWideObject)
+{
+  // Enough members for lookups to be hashed, in the reverse of the order in which they are loaded
+  std::string serialized = "{";
+  for (int n = 63; n >= 0; --n)
+  {
+    serialized += "\"member_" + std::to_string(n) + "\":" + std::to_string(n) + ((n > 0) ? "," : "}");
+  }
+  this->create_iarchive(serialized.c_str());
+
+  for (int n = 0; n < 64; ++n)
+  {
+    int value;
+    ((*ar) & boost::serialization::make_nvp(("member_" + std::to_string(n)).c_str(), value));
+    ASSERT_EQ(value, n);
+  }
+
+  ASSERT_EQ(ar->lookup_stats().cursor_hits, 0UL);
+  ASSERT_EQ(ar->lookup_stats().cursor_misses, 64UL);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeInOrderLookup)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"int\":1,"
+      "\"nested_struct\":{"
+        "\"_class_id_optional\":0,"
+        "\"_tracking\":false,"
+        "\"_version\":0,"
+        "\"first\":{"
+          "\"_class_id_optional\":1,"
+          "\"_tracking\":false,"
+          "\"_version\":0,"
+          "\"m\":2"
+        "},"
+        "\"second\":{\"m\":3}"
+      "},"
+      "\"string\":\"document\""
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  int int_value;
+  NestedTestStruct nested_value;
+  std::string string_value;
+  ((*ar) & boost::serialization::make_nvp("int", int_value));
+  ((*ar) & boost::serialization::make_nvp("nested_struct", nested_value));
+  ((*ar) & boost::serialization::make_nvp("string", string_value));
+
+  ASSERT_EQ(int_value, 1);
+  ASSERT_EQ(nested_value.first.m, 2);
+  ASSERT_EQ(nested_value.second.m, 3);
+  ASSERT_EQ(string_value, "document");
+  ASSERT_EQ(ar->lookup_stats().cursor_hits, 13UL);
+  ASSERT_EQ(ar->lookup_stats().cursor_misses, 0UL);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnSyntaxError)
+{
+  static const char* SERIALIZED = "{\"int_array\":[1,2 3]}";
+  ASSERT_THROW(this->create_iarchive(SERIALIZED), boost::archive::json_archive_exception);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeIndexed)
+{
+  // clang-format off
+  static const std::string SERIALIZED =
+    "{\n"
+    "  \"struct\" : { \"m\" : -7 },\n"
+    "  \"string\" : \"quote \\\" backslash \\\\\",\n"
+    "  \"double_array\" : [ 1.5e2, -0.25, 3 ],\n"
+    "  \"empty_array\" : [ ],\n"
+    "  \"bool\" : true\n"
+    "}\n";
+  // clang-format on
+  boost::archive::json_iarchive indexed_ar{
+    SERIALIZED.data(), SERIALIZED.size(), std::pmr::get_default_resource(), boost::archive::json_indexed_parse};
+
+  TestStruct struct_value;
+  std::string string_value;
+  std::vector<double> double_array_value;
+  std::vector<int> empty_array_value{1};
+  bool bool_value = false;
+  indexed_ar & boost::serialization::make_nvp("struct", struct_value);
+  indexed_ar & boost::serialization::make_nvp("string", string_value);
+  indexed_ar & boost::serialization::make_nvp("double_array", double_array_value);
+  indexed_ar & boost::serialization::make_nvp("empty_array", empty_array_value);
+  indexed_ar & boost::serialization::make_nvp("bool", bool_value);
+
+  const std::vector<double> double_array_value_target{150.0, -0.25, 3.0};
+  ASSERT_EQ(struct_value.m, -7);
+  ASSERT_EQ(string_value, "quote \" backslash \\");
+  ASSERT_EQ(double_array_value, double_array_value_target);
+  ASSERT_TRUE(empty_array_value.empty());
+  ASSERT_TRUE(bool_value);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeIndexedThrowOnSyntaxError)
+{
+  for (const std::string serialized : {
+         "{\"int_array\":[1,2 3]}",
+         "{\"int_array\":[1,2,]}",
+         "{\"m\":1,}",
+         "{\"m\" 1}",
+         "{\"m\":tru}",
+         "{\"m\":12abc}",
+         "{\"m\":1}]",
+         "{\"m\":\"unterminated}",
+         "{\"m\":"})
+  {
+    ASSERT_THROW(
+      (boost::archive::json_iarchive{
+        serialized.data(), serialized.size(), std::pmr::get_default_resource(), boost::archive::json_indexed_parse}),
+      boost::archive::json_archive_exception)
+      << serialized;
+  }
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeLazy)
+{
+  // clang-format off
+  static const std::string SERIALIZED =
+    "{\n"
+    "  \"nested_struct\" : { \"first\" : { \"m\" : 1 }, \"second\" : { \"m\" : 2 } },\n"
+    "  \"skipped\" : [ { \"s\" : \"]}[{\\\"\" }, [ [ ] ] ],\n"
+    "  \"struct_array\" : [ { \"m\" : 3 }, { \"m\" : 4 } ],\n"
+    "  \"empty_array\" : [ ],\n"
+    "  \"double\" : 0.5\n"
+    "}\n";
+  // clang-format on
+  std::istringstream iss{SERIALIZED};
+  boost::archive::json_iarchive lazy_ar{iss, std::pmr::get_default_resource(), boost::archive::json_lazy_parse};
+
+  NestedTestStruct nested_struct_value;
+  std::vector<TestStruct> struct_array_value;
+  std::vector<int> empty_array_value{1};
+  double double_value = 0;
+  lazy_ar & boost::serialization::make_nvp("double", double_value);
+  lazy_ar & boost::serialization::make_nvp("struct_array", struct_array_value);
+  lazy_ar & boost::serialization::make_nvp("nested_struct", nested_struct_value);
+  lazy_ar & boost::serialization::make_nvp("empty_array", empty_array_value);
+
+  ASSERT_EQ(nested_struct_value.first.m, 1);
+  ASSERT_EQ(nested_struct_value.second.m, 2);
+  ASSERT_EQ(struct_array_value.size(), 2UL);
+  ASSERT_EQ(struct_array_value[0].m, 3);
+  ASSERT_EQ(struct_array_value[1].m, 4);
+  ASSERT_TRUE(empty_array_value.empty());
+  ASSERT_EQ(double_value, 0.5);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeLazySkipsUnreadValues)
+{
+  static const std::string SERIALIZED = "{\"header\":{\"m\":7},\"body\":[{\"m\":1 2}]}";
+  boost::archive::json_iarchive lazy_ar{
+    SERIALIZED.data(), SERIALIZED.size(), std::pmr::get_default_resource(), boost::archive::json_lazy_parse};
+
+  TestStruct header_value;
+  lazy_ar & boost::serialization::make_nvp("header", header_value);
+  ASSERT_EQ(header_value.m, 7);
+
+  std::vector<TestStruct> body_value;
+  ASSERT_THROW(
+    (lazy_ar & boost::serialization::make_nvp("body", body_value)), boost::archive::json_archive_exception);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeLazyThrowOnSyntaxError)
+{
+  for (const std::string serialized : {
+         "{\"m\":1,}",
+         "{\"m\" 1}",
+         "{\"m\":tru}",
+         "{\"m\":1}]",
+         "{\"m\":\"unterminated}",
+         "{\"m\":[[1]",
+         "{\"m\":"})
+  {
+    ASSERT_THROW(
+      (boost::archive::json_iarchive{
+        serialized.data(), serialized.size(), std::pmr::get_default_resource(), boost::archive::json_lazy_parse}),
+      boost::archive::json_archive_exception)
+      << serialized;
+  }
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeLazyThrowsLikeEager)
+{
+  for (const std::string serialized : {
+         "{\"m\":[}]}",
+         "{\"m\":[[1],[2}]}",
+         "{\"m\":[[1],[2]}",
+         "{\"m\":[[1],[2,x]]}",
+         "{\"n\":{\"m\":[}]},\"m\":[]}"})
+  {
+    std::string eager_what;
+    try
+    {
+      boost::archive::json_iarchive{serialized.data(), serialized.size()};
+    }
+    catch (const boost::archive::json_archive_exception& ex)
+    {
+      eager_what = ex.what();
+    }
+    ASSERT_FALSE(eager_what.empty()) << serialized;
+
+    // Errors in deferred values are thrown once they are loaded, with offsets into the whole input
+    std::string lazy_what;
+    try
+    {
+      boost::archive::json_iarchive lazy_ar{
+        serialized.data(), serialized.size(), std::pmr::get_default_resource(), boost::archive::json_lazy_parse};
+      std::vector<std::vector<int>> value;
+      lazy_ar & boost::serialization::make_nvp("m", value);
+    }
+    catch (const boost::archive::json_archive_exception& ex)
+    {
+      lazy_what = ex.what();
+    }
+    ASSERT_EQ(lazy_what, eager_what) << serialized;
+  }
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeParallel)
+{
+  std::string serialized = "{\"header\":{\"m\":-1},\"struct_array\":[";
+  for (int n = 0; n < 10000; ++n)
+  {
+    serialized += (n == 0) ? "{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":0}"
+                           : ",{\"m\":" + std::to_string(n) + "}";
+  }
+  serialized += "],\"string_array\":[\"[\",\"]\\\"\"]}";
+  boost::archive::json_iarchive parallel_ar{
+    serialized.data(), serialized.size(), std::pmr::get_default_resource(), boost::archive::json_parallel_parse};
+
+  TestStruct header_value;
+  std::vector<TestStruct> struct_array_value;
+  std::vector<std::string> string_array_value;
+  parallel_ar & boost::serialization::make_nvp("header", header_value);
+  parallel_ar & boost::serialization::make_nvp("struct_array", struct_array_value);
+  parallel_ar & boost::serialization::make_nvp("string_array", string_array_value);
+
+  ASSERT_EQ(header_value.m, -1);
+  ASSERT_EQ(struct_array_value.size(), 10000UL);
+  for (std::size_t n = 0; n < struct_array_value.size(); ++n)
+  {
+    ASSERT_EQ(struct_array_value[n].m, static_cast<int>(n));
+  }
+  const std::vector<std::string> string_array_value_target{"[", "]\""};
+  ASSERT_EQ(string_array_value, string_array_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeParallelThrowOnSyntaxError)
+{
+  for (const std::string last_element : {"1x", "1 2", "{\"m\":}", "[1,]", "\"unterminated"})
+  {
+    std::string serialized = "{\"int_array\":[";
+    for (int n = 0; n < 10000; ++n)
+    {
+      serialized += std::to_string(n) + ",";
+    }
+    serialized += last_element + "]}";
+    ASSERT_THROW(
+      (boost::archive::json_iarchive{
+        serialized.data(), serialized.size(), std::pmr::get_default_resource(), boost::archive::json_parallel_parse}),
+      boost::archive::json_archive_exception)
+      << last_element;
+  }
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeFromBuffer)
+{
+  static const std::string SERIALIZED = "{\"struct\":{\"m\":7},\"int_array\":[1,2,3,4]}";
+  boost::archive::json_iarchive buffer_ar{SERIALIZED.data(), SERIALIZED.size()};
+
+  TestStruct struct_value;
+  std::vector<int> int_array_value;
+  buffer_ar & boost::serialization::make_nvp("struct", struct_value);
+  buffer_ar & boost::serialization::make_nvp("int_array", int_array_value);
+
+  const std::vector<int> int_array_value_target{1, 2, 3, 4};
+  ASSERT_EQ(struct_value.m, 7);
+  ASSERT_EQ(int_array_value, int_array_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeWithMemoryResource)
+{
+  static const std::string SERIALIZED =
+    "{\"struct\":{\"m\":7},\"string_array\":[\"a long string which is not stored inline\",\"b\"]}";
+  CountingResource upstream;
+
+  // Document must not allocate from the default resource
+  auto* const default_resource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+  std::optional<boost::archive::json_iarchive> resource_ar;
+  resource_ar.emplace(SERIALIZED.data(), SERIALIZED.size(), &upstream);
+  std::pmr::set_default_resource(default_resource);
+
+  TestStruct struct_value;
+  std::vector<std::string> string_array_value;
+  (*resource_ar) & boost::serialization::make_nvp("struct", struct_value);
+  (*resource_ar) & boost::serialization::make_nvp("string_array", string_array_value);
+
+  const std::vector<std::string> string_array_value_target{"a long string which is not stored inline", "b"};
+  ASSERT_GT(upstream.n_allocations, 0UL);
+  ASSERT_EQ(struct_value.m, 7);
+  ASSERT_EQ(string_array_value, string_array_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeWithBuffers)
+{
+  static const std::string SERIALIZED =
+    "{\"struct\":{\"m\":7},\"string_array\":[\"a long string which is not stored inline\",\"b\"]}";
+  CountingResource upstream;
+  boost::archive::json_archive_buffers buffers{&upstream};
+
+  std::size_t n_allocations_first = 0;
+  for (int n = 0; n < 3; ++n)
+  {
+    std::istringstream is{SERIALIZED};
+    boost::archive::json_iarchive buffers_ar{is, buffers};
+
+    TestStruct struct_value;
+    std::vector<std::string> string_array_value;
+    buffers_ar & boost::serialization::make_nvp("struct", struct_value);
+    buffers_ar & boost::serialization::make_nvp("string_array", string_array_value);
+
+    const std::vector<std::string> string_array_value_target{"a long string which is not stored inline", "b"};
+    ASSERT_EQ(struct_value.m, 7);
+    ASSERT_EQ(string_array_value, string_array_value_target);
+    ASSERT_EQ(buffers.input_text(), SERIALIZED);
+
+    // Blocks allocated for the first message are reused by the others
+    if (n == 0)
+    {
+      n_allocations_first = upstream.n_allocations;
+    }
+    ASSERT_EQ(upstream.n_allocations, n_allocations_first);
+  }
+  ASSERT_GT(n_allocations_first, 0UL);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeWithBuffersThrowOnParallelParse)
+{
+  static const std::string SERIALIZED = "{\"value\":1}";
+  boost::archive::json_archive_buffers buffers;
+
+  std::istringstream is{SERIALIZED};
+  ASSERT_THROW(
+    (boost::archive::json_iarchive{is, buffers, boost::archive::json_parallel_parse}), std::invalid_argument);
+  ASSERT_THROW(
+    (boost::archive::json_iarchive{
+      SERIALIZED.data(), SERIALIZED.size(), buffers, boost::archive::json_parallel_parse}),
+    std::invalid_argument);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeLargeStream)
+{
+  std::vector<std::string> string_array_value_target(50000);
+  buffer << "{\"string_array\":[";
+  for (std::size_t i = 0; i < string_array_value_target.size(); ++i)
+  {
+    string_array_value_target[i] = "element_" + std::to_string(i);
+    buffer << (i ? "," : "") << '"' << string_array_value_target[i] << '"';
+  }
+  buffer << "]}";
+  ar.emplace(buffer);
+
+  std::vector<std::string> value;
+  ((*ar) & boost::serialization::make_nvp("string_array", value));
+
+  ASSERT_EQ(value, string_array_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeFromFile)
+{
+  const std::string path = ::testing::TempDir() + "json_iarchive_DeserializeFromFile.json";
+  {
+    std::ofstream ofs{path};
+    ofs << "{\"struct\":{\"m\":7},\"string\":\"es\\\"caped\",\"int_array\":[1,2,3,4]}";
+  }
+
+  TestStruct struct_value;
+  std::string string_value;
+  std::vector<int> int_array_value;
+  {
+    boost::archive::json_iarchive file_ar{std::filesystem::path{path}};
+    file_ar & boost::serialization::make_nvp("int_array", int_array_value);
+    file_ar & boost::serialization::make_nvp("string", string_value);
+    file_ar & boost::serialization::make_nvp("struct", struct_value);
+  }
+  std::remove(path.c_str());
+
+  const std::vector<int> int_array_value_target{1, 2, 3, 4};
+  ASSERT_EQ(struct_value.m, 7);
+  ASSERT_EQ(string_value, "es\"caped");
+  ASSERT_EQ(int_array_value, int_array_value_target);
+}
+
+TEST_F(json_iarchive_test_suite, DeserializeThrowOnMissingFile)
+{
+  ASSERT_THROW(
+    boost::archive::json_iarchive{std::filesystem::path{"/nonexistent/file.json"}},
+    boost::archive::json_archive_exception
+  );
+}
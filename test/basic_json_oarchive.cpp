@@ -1,12 +1,29 @@
 
 // C++ Standard Library
+#include <bitset>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
 // GTest
 #include <gtest/gtest.h>
 
+// Boost
+#include <boost/serialization/unique_ptr.hpp>
+#include <boost/serialization/version.hpp>
+
 // Boost Archive JSON
 #include <boost/archive/json_oarchive.h>
 
@@ -41,6 +58,96 @@ public:
     }
   };
 
+  /// Only ever serialized through pointers, which makes Boost track objects of this type
+  struct PointeeTestStruct
+  {
+    int m = 111;
+
+    PointeeTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  /// Nested one level deeper with each node
+  struct ListTestStruct
+  {
+    int m = 0;
+    std::unique_ptr<ListTestStruct> next;
+
+    ListTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+      ar& BOOST_SERIALIZATION_NVP(next);
+    }
+  };
+
+  struct VersionedTestStruct
+  {
+    int m = 111;
+
+    VersionedTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  /// Saves a different selection of members, in a different order, depending on its mode; one type per test
+  template <int Id> struct VaryingTestStruct
+  {
+    int mode = 0;
+
+    VaryingTestStruct() = default;
+
+    explicit VaryingTestStruct(const int _mode) : mode{_mode} {}
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      int a = 1, b = 2, c = 3;
+      ar& BOOST_SERIALIZATION_NVP(mode);
+      if (mode == 0)
+      {
+        ar& BOOST_SERIALIZATION_NVP(a);
+        ar& BOOST_SERIALIZATION_NVP(b);
+      }
+      else if (mode == 1)
+      {
+        ar& BOOST_SERIALIZATION_NVP(b);
+        ar& BOOST_SERIALIZATION_NVP(a);
+        ar& BOOST_SERIALIZATION_NVP(c);
+      }
+      else
+      {
+        ar& BOOST_SERIALIZATION_NVP(a);
+        ar& boost::serialization::make_nvp("a", b);
+      }
+    }
+  };
+
+  struct CountingResource : std::pmr::memory_resource
+  {
+    std::size_t n_allocations = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      ++n_allocations;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+      std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+  };
+
   void SetUp() override {}
 
   void TearDown() override {}
@@ -49,6 +156,8 @@ public:
   std::optional<boost::archive::json_oarchive> ar;
 };
 
+BOOST_CLASS_VERSION(json_oarchive_test_suite::VersionedTestStruct, 2)
+
 TEST_F(json_oarchive_test_suite, SerializeBool)
 {
   const bool value = true;
@@ -85,6 +194,30 @@ TEST_F(json_oarchive_test_suite, SerializeDouble)
   ASSERT_EQ(buffer.str(), SERIALIZED);
 }
 
+TEST_F(json_oarchive_test_suite, SerializeFloatShortest)
+{
+  const float value = 0.1f;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("float", value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"float\":0.1}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeDoubleShortest)
+{
+  const double value = 0.1 + 0.2;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("double", value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"double\":0.30000000000000004}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
 TEST_F(json_oarchive_test_suite, SerializeInt)
 {
   const int value = 99;
@@ -97,6 +230,32 @@ TEST_F(json_oarchive_test_suite, SerializeInt)
   ASSERT_EQ(buffer.str(), SERIALIZED);
 }
 
+TEST_F(json_oarchive_test_suite, SerializeInt64)
+{
+  const std::int64_t min_value = std::numeric_limits<std::int64_t>::min();
+  const std::int64_t max_value = std::numeric_limits<std::int64_t>::max();
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("min", min_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("max", max_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"min\":-9223372036854775808,\"max\":9223372036854775807}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeUInt64)
+{
+  const std::uint64_t value = std::numeric_limits<std::uint64_t>::max();
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("uint64", value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"uint64\":18446744073709551615}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
 TEST_F(json_oarchive_test_suite, SerializeString)
 {
   const std::string value = "hello";
@@ -109,6 +268,32 @@ TEST_F(json_oarchive_test_suite, SerializeString)
   ASSERT_EQ(buffer.str(), SERIALIZED);
 }
 
+TEST_F(json_oarchive_test_suite, SerializeLongEscapedString)
+{
+  // Characters to escape on both sides of each 16- and 32-character block boundary
+  std::string value;
+  std::string escaped;
+  for (int n = 0; n < 100; ++n)
+  {
+    if (n % 16 == 0 or n % 16 == 15)
+    {
+      value += (n % 32 == 0) ? '"' : '\x1f';
+      escaped += (n % 32 == 0) ? "\\\"" : "\\u001f";
+    }
+    else
+    {
+      value += static_cast<char>('a' + n % 26);
+      escaped += static_cast<char>('a' + n % 26);
+    }
+  }
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("string", value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  ASSERT_EQ(buffer.str(), "{\"string\":\"" + escaped + "\"}");
+}
+
 TEST_F(json_oarchive_test_suite, SerializeStruct)
 {
   const TestStruct value;
@@ -163,6 +348,71 @@ TEST_F(json_oarchive_test_suite, SerializeNestedStruct)
   ASSERT_EQ(buffer.str(), SERIALIZED);
 }
 
+TEST_F(json_oarchive_test_suite, SerializePointer)
+{
+  std::unique_ptr<PointeeTestStruct> ptr_value{new PointeeTestStruct};
+  ptr_value->m = 222;
+  const PointeeTestStruct* alias_value = ptr_value.get();
+  const std::unique_ptr<PointeeTestStruct> null_value;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("ptr", ptr_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("alias", alias_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("null", null_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"ptr\":{"
+        "\"_class_id_optional\":0,"
+        "\"_tracking\":false,"
+        "\"_version\":0,"
+        "\"tx\":{"
+          "\"_class_id\":1,"
+          "\"_tracking\":true,"
+          "\"_version\":0,"
+          "\"_object_id\":0,"
+          "\"m\":222"
+        "}"
+      "},"
+      "\"alias\":{\"_class_id_reference\":1,\"_object_reference\":0},"
+      "\"null\":{\"tx\":{\"_class_id\":-1}}"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeDeeplyNested)
+{
+  // Nested deeper than the active values which are tracked without allocating
+  ListTestStruct list_value;
+  ListTestStruct* tail = &list_value;
+  for (int n = 1; n < 32; ++n)
+  {
+    tail->next.reset(new ListTestStruct);
+    tail = tail->next.get();
+    tail->m = n;
+  }
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("list", list_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  std::string serialized =
+    "{\"list\":{\"_class_id_optional\":0,\"_tracking\":true,\"_version\":0,\"_object_id\":0,\"m\":0,"
+    "\"next\":{\"_class_id_optional\":1,\"_tracking\":false,\"_version\":0,\"tx\":";
+  for (int n = 1; n < 32; ++n)
+  {
+    const std::string id = std::to_string(n);
+    serialized += "{\"_class_id_reference\":0,\"_object_id\":" + id + ",\"m\":" + id + ",\"next\":{\"tx\":";
+  }
+  serialized += "{\"_class_id\":-1}" + std::string(2 * 32 + 1, '}');
+
+  ASSERT_EQ(buffer.str(), serialized);
+}
+
 TEST_F(json_oarchive_test_suite, SerializeBoolStdVector)
 {
   std::vector<bool> bool_array_value{true, false, true, false};
@@ -176,6 +426,21 @@ TEST_F(json_oarchive_test_suite, SerializeBoolStdVector)
   ASSERT_EQ(buffer.str(), SERIALIZED);
 }
 
+TEST_F(json_oarchive_test_suite, SerializeBoolStdBitset)
+{
+  std::bitset<4> bitset_value;
+  bitset_value.set(0);
+  bitset_value.set(2);
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("bitset", bitset_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"bitset\":[true,false,true,false]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
 TEST_F(json_oarchive_test_suite, SerializeIntStdVector)
 {
   std::vector<int> int_array_value{1, 2, 3, 4};
@@ -249,6 +514,158 @@ TEST_F(json_oarchive_test_suite, SerializeStructStdVector)
   ASSERT_EQ(buffer.str(), SERIALIZED);
 }
 
+TEST_F(json_oarchive_test_suite, SerializeVaryingStructStdVector)
+{
+  using Varying = VaryingTestStruct<0>;
+  std::vector<Varying> struct_array_value{Varying{0}, Varying{1}, Varying{2}, Varying{0}};
+  ((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct_array\":["
+        "{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"mode\":0,\"a\":1,\"b\":2},"
+        "{\"mode\":1,\"b\":2,\"a\":1,\"c\":3},"
+        "{\"mode\":2,\"a\":2},"
+        "{\"mode\":0,\"a\":1,\"b\":2}"
+      "]"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeRepeatedMemberStdVector)
+{
+  using Varying = VaryingTestStruct<1>;
+  std::vector<Varying> struct_array_value{Varying{2}, Varying{0}, Varying{2}};
+  ((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct_array\":["
+        "{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"mode\":2,\"a\":2},"
+        "{\"mode\":0,\"a\":1,\"b\":2},"
+        "{\"mode\":2,\"a\":2}"
+      "]"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeCompactMetadata)
+{
+  std::ostringstream os;
+  {
+    boost::archive::json_oarchive compact_ar{
+      os, false, std::pmr::get_default_resource(), boost::archive::json_compact_metadata};
+    const std::vector<TestStruct> struct_array_value{TestStruct{}, TestStruct{}};
+    const VersionedTestStruct versioned_value;
+    std::unique_ptr<PointeeTestStruct> ptr_value{new PointeeTestStruct};
+    ptr_value->m = 222;
+    ASSERT_NO_THROW(compact_ar & boost::serialization::make_nvp("struct_array", struct_array_value));
+    ASSERT_NO_THROW(compact_ar & boost::serialization::make_nvp("versioned", versioned_value));
+    ASSERT_NO_THROW(compact_ar & boost::serialization::make_nvp("ptr", ptr_value));
+  }
+
+  // Only untracked classes at version 0 lose their class information
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct_array\":[{\"m\":111},{\"m\":111}],"
+      "\"versioned\":{\"_class_id_optional\":1,\"_tracking\":false,\"_version\":2,\"m\":111},"
+      "\"ptr\":{"
+        "\"tx\":{"
+          "\"_class_id\":3,"
+          "\"_tracking\":true,"
+          "\"_version\":0,"
+          "\"_object_id\":0,"
+          "\"m\":222"
+        "}"
+      "}"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(os.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeFloatStdVectorBinary)
+{
+  std::ostringstream os;
+  {
+    boost::archive::json_oarchive binary_ar{os, false, std::pmr::get_default_resource(), boost::archive::json_binary_arrays};
+    const std::vector<float> float_array_value{1.5f, -2.0f};
+    ASSERT_NO_THROW(binary_ar & boost::serialization::make_nvp("float_array", float_array_value));
+  }
+
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\"<f4\",\"shape\":[2],\"data\":\"AADAPwAAAMA=\"}}";
+
+  ASSERT_EQ(os.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeFlagsAfterPrettify)
+{
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\"<f4\",\"shape\":[2],\"data\":\"AADAPwAAAMA=\"}}";
+  const std::vector<float> float_array_value{1.5f, -2.0f};
+
+  // Flags follow prettify directly, as they do for json_stream_oarchive
+  std::ostringstream os;
+  {
+    boost::archive::json_oarchive flags_ar{os, false, boost::archive::json_binary_arrays};
+    ASSERT_NO_THROW(flags_ar & boost::serialization::make_nvp("float_array", float_array_value));
+  }
+  ASSERT_EQ(os.str(), SERIALIZED);
+
+  struct StringSink
+  {
+    std::string data;
+
+    void write(const char* d, std::size_t n) { data.append(d, n); }
+  } sink;
+  {
+    boost::archive::json_oarchive flags_ar{sink, false, boost::archive::json_binary_arrays};
+    ASSERT_NO_THROW(flags_ar & boost::serialization::make_nvp("float_array", float_array_value));
+  }
+  ASSERT_EQ(sink.data, SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeParallel)
+{
+  std::vector<TestStruct> struct_array_value(5000);
+  std::vector<double> double_array_value(5000);
+  for (std::size_t n = 0; n < double_array_value.size(); ++n)
+  {
+    struct_array_value[n].m = static_cast<int>(n);
+    double_array_value[n] = 0.5 * static_cast<double>(n);
+  }
+
+  for (const bool prettify : {false, true})
+  {
+    std::ostringstream os;
+    std::ostringstream parallel_os;
+    {
+      boost::archive::json_oarchive oar{os, prettify};
+      boost::archive::json_oarchive parallel_ar{
+        parallel_os, prettify, std::pmr::get_default_resource(), boost::archive::json_parallel_serialize};
+      for (auto* const archive : {&oar, &parallel_ar})
+      {
+        (*archive) & boost::serialization::make_nvp("struct_array", struct_array_value);
+        (*archive) & boost::serialization::make_nvp("double_array", double_array_value);
+      }
+    }
+
+    ASSERT_EQ(parallel_os.str(), os.str());
+  }
+}
+
 TEST_F(json_oarchive_test_suite, SerializeBoolStdArray)
 {
   std::array<bool, 4> bool_array_value{true, false, true, false};
@@ -334,3 +751,198 @@ TEST_F(json_oarchive_test_suite, SerializeStructStdArray)
 
   ASSERT_EQ(buffer.str(), SERIALIZED);
 }
+
+TEST_F(json_oarchive_test_suite, SerializeStringKeyStdMap)
+{
+  std::map<std::string, int> map_value{{"b", 2}, {"a", 1}, {"quote\"d", 3}};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("map", map_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"map\":{\"a\":1,\"b\":2,\"quote\\\"d\":3}}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeStructStdUnorderedMap)
+{
+  std::unordered_map<std::string, TestStruct> map_value{{"a", TestStruct{}}};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("map", map_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED =
+    "{\"map\":{\"a\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111}}}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeIntKeyStdMap)
+{
+  std::map<int, std::string> map_value{{2, "two"}, {1, "one"}};
+  std::multimap<std::string, int> multimap_value{{"a", 1}, {"a", 2}};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("map", map_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("multimap", multimap_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"map\":[[1,\"one\"],[2,\"two\"]],\"multimap\":[[\"a\",1],[\"a\",2]]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeStdSequences)
+{
+  std::set<int> set_value{3, 1, 2};
+  std::deque<double> deque_value{1.5, 2.5};
+  std::list<std::string> list_value{"a", "b"};
+  std::forward_list<int> forward_list_value{1, 2};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("set", set_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("deque", deque_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("list", list_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("forward_list", forward_list_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED =
+    "{\"set\":[1,2,3],\"deque\":[1.5,2.5],\"list\":[\"a\",\"b\"],\"forward_list\":[1,2]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeStdOptional)
+{
+  std::optional<int> empty_value;
+  std::optional<int> int_value{5};
+  std::vector<std::optional<TestStruct>> struct_array_value{std::nullopt, TestStruct{}};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("empty", empty_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("int", int_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"empty\":null,"
+      "\"int\":5,"
+      "\"struct_array\":[null,{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111}]"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeStdVariant)
+{
+  std::variant<int, std::string> string_value{std::string{"x"}};
+  std::variant<std::monostate, int> empty_value;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("string", string_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("empty", empty_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"string\":{\"which\":1,\"value\":\"x\"},\"empty\":{\"which\":0}}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeInsertionOrder)
+{
+  const int z = 1, a = 2, m = 3;
+  ASSERT_NO_THROW((*ar) & BOOST_SERIALIZATION_NVP(z));
+  ASSERT_NO_THROW((*ar) & BOOST_SERIALIZATION_NVP(a));
+  ASSERT_NO_THROW((*ar) & BOOST_SERIALIZATION_NVP(m));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"z\":1,\"a\":2,\"m\":3}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeToSink)
+{
+  struct StringSink
+  {
+    std::string data;
+    std::size_t n_writes = 0;
+
+    void write(const char* d, std::size_t n)
+    {
+      data.append(d, n);
+      ++n_writes;
+    }
+  };
+
+  StringSink sink;
+  {
+    boost::archive::json_oarchive sink_ar{sink};
+    const std::vector<int> int_array_value{1, 2, 3, 4};
+    sink_ar & boost::serialization::make_nvp("int_array", int_array_value);
+  }
+
+  static const char* SERIALIZED = "{\"int_array\":[1,2,3,4]}";
+  ASSERT_EQ(sink.data, SERIALIZED);
+  ASSERT_EQ(sink.n_writes, 1UL);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeWithMemoryResource)
+{
+  CountingResource upstream;
+  std::ostringstream os;
+
+  // Document must not allocate from the default resource
+  auto* const default_resource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+  {
+    boost::archive::json_oarchive resource_ar{os, false, &upstream};
+    const std::vector<std::string> string_array_value{"a long string which is not stored inline", "b"};
+    const NestedTestStruct struct_value;
+    resource_ar & boost::serialization::make_nvp("string_array", string_array_value);
+    resource_ar & boost::serialization::make_nvp("nested_struct", struct_value);
+  }
+  std::pmr::set_default_resource(default_resource);
+
+  ASSERT_GT(upstream.n_allocations, 0UL);
+  ASSERT_NE(os.str().find("a long string which is not stored inline"), std::string::npos);
+}
+
+TEST_F(json_oarchive_test_suite, SerializeWithBuffers)
+{
+  CountingResource upstream;
+  boost::archive::json_archive_buffers buffers{&upstream};
+
+  std::size_t n_allocations_first = 0;
+  for (int n = 0; n < 3; ++n)
+  {
+    std::ostringstream os;
+    {
+      boost::archive::json_oarchive buffers_ar{os, buffers};
+      const std::vector<std::string> string_array_value{"a long string which is not stored inline", "b"};
+      const NestedTestStruct struct_value;
+      buffers_ar & boost::serialization::make_nvp("string_array", string_array_value);
+      buffers_ar & boost::serialization::make_nvp("nested_struct", struct_value);
+    }
+
+    // Class information is written to every message, since each archive keeps its own
+    static const char* SERIALIZED =
+      "{\"string_array\":[\"a long string which is not stored inline\",\"b\"],"
+      "\"nested_struct\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,"
+      "\"first\":{\"_class_id_optional\":1,\"_tracking\":false,\"_version\":0,\"m\":111},\"second\":{\"m\":111}}}";
+    ASSERT_EQ(os.str(), SERIALIZED);
+
+    // Blocks allocated for the first message are reused by the others
+    if (n == 0)
+    {
+      n_allocations_first = upstream.n_allocations;
+    }
+    ASSERT_EQ(upstream.n_allocations, n_allocations_first);
+  }
+  ASSERT_GT(n_allocations_first, 0UL);
+}
@@ -0,0 +1,1101 @@
+
+// C++ Standard Library
+#include <bitset>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <forward_list>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Boost
+#include <boost/serialization/unique_ptr.hpp>
+
+// Boost Archive JSON
+#include <boost/archive/json_stream_iarchive.h>
+#include <boost/archive/json_stream_oarchive.h>
+
+class json_stream_iarchive_test_suite : public ::testing::Test
+{
+public:
+  json_stream_iarchive_test_suite() : buffer{} {}
+
+  struct TestStruct
+  {
+    int m = 111;
+
+    TestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+
+    inline bool operator==(const TestStruct& other) const { return other.m == this->m; }
+  };
+
+  struct NestedTestStruct
+  {
+    TestStruct first;
+    TestStruct second;
+
+    NestedTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(first);
+      ar& BOOST_SERIALIZATION_NVP(second);
+    }
+
+    inline bool operator==(const NestedTestStruct& other) const
+    {
+      return other.first == this->first and other.second == this->second;
+    }
+  };
+
+  struct VersionedTestStruct
+  {
+    unsigned int file_version = 0;
+    int m = 0;
+
+    VersionedTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      this->file_version = file_version;
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  /// Only ever serialized through pointers, which makes Boost track objects of this type
+  struct PointeeTestStruct
+  {
+    int m = 111;
+
+    PointeeTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  struct ArrayTestStruct
+  {
+    std::vector<double> values;
+    int m = 0;
+
+    ArrayTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(values);
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  struct CountingResource : std::pmr::memory_resource
+  {
+    std::size_t n_allocations = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+      ++n_allocations;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+      std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+  };
+
+  void create_iarchive(const char* serialized)
+  {
+    buffer << serialized;
+    ar.emplace(buffer);
+  }
+
+  void SetUp() override {}
+
+  void TearDown() override {}
+
+  std::stringstream buffer;
+  std::optional<boost::archive::json_stream_iarchive> ar;
+};
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnEmpty)
+{
+  static const char* SERIALIZED = "";
+  this->create_iarchive(SERIALIZED);
+
+  bool value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("bool", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnMissing)
+{
+  static const char* SERIALIZED = "{\"bool\":true}";
+  this->create_iarchive(SERIALIZED);
+
+  bool value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("not_bool", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeBool)
+{
+  static const char* SERIALIZED = "{\"bool\":true}";
+  this->create_iarchive(SERIALIZED);
+
+  bool value;
+  ((*ar) & boost::serialization::make_nvp("bool", value));
+
+  ASSERT_EQ(value, true);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeFloat)
+{
+  static const char* SERIALIZED = "{\"float\":123}";
+  this->create_iarchive(SERIALIZED);
+
+  float value;
+  ((*ar) & boost::serialization::make_nvp("float", value));
+
+  ASSERT_EQ(value, 123.0f);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeDouble)
+{
+  static const char* SERIALIZED = "{\"double\":123.456}";
+  this->create_iarchive(SERIALIZED);
+
+  double value;
+  ((*ar) & boost::serialization::make_nvp("double", value));
+
+  ASSERT_EQ(value, 123.456);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeShortestRoundTrip)
+{
+  static const char* SERIALIZED = "{\"float\":0.1,\"double\":0.30000000000000004,\"large\":1e+300}";
+  this->create_iarchive(SERIALIZED);
+
+  float float_value;
+  double double_value;
+  double large_value;
+  ((*ar) & boost::serialization::make_nvp("float", float_value));
+  ((*ar) & boost::serialization::make_nvp("double", double_value));
+  ((*ar) & boost::serialization::make_nvp("large", large_value));
+
+  ASSERT_EQ(float_value, 0.1f);
+  ASSERT_EQ(double_value, 0.1 + 0.2);
+  ASSERT_EQ(large_value, 1e300);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnNumberOutOfRange)
+{
+  static const char* SERIALIZED = "{\"double\":1e400}";
+  this->create_iarchive(SERIALIZED);
+
+  double value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("double", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeInt)
+{
+  static const char* SERIALIZED = "{\"int\":99}";
+  this->create_iarchive(SERIALIZED);
+
+  int value;
+  ((*ar) & boost::serialization::make_nvp("int", value));
+
+  ASSERT_EQ(value, 99);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeInt64)
+{
+  static const char* SERIALIZED = "{\"max\":9223372036854775807,\"min\":-9223372036854775808}";
+  this->create_iarchive(SERIALIZED);
+
+  std::int64_t max_value;
+  std::int64_t min_value;
+  ((*ar) & boost::serialization::make_nvp("max", max_value));
+  ((*ar) & boost::serialization::make_nvp("min", min_value));
+
+  ASSERT_EQ(max_value, std::numeric_limits<std::int64_t>::max());
+  ASSERT_EQ(min_value, std::numeric_limits<std::int64_t>::min());
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeUInt64)
+{
+  static const char* SERIALIZED = "{\"uint64\":18446744073709551615,\"large\":9007199254740993}";
+  this->create_iarchive(SERIALIZED);
+
+  std::uint64_t value;
+  unsigned long long large_value;
+  ((*ar) & boost::serialization::make_nvp("uint64", value));
+  ((*ar) & boost::serialization::make_nvp("large", large_value));
+
+  ASSERT_EQ(value, std::numeric_limits<std::uint64_t>::max());
+  ASSERT_EQ(large_value, 9007199254740993ULL);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnIntegerOutOfRange)
+{
+  static const char* SERIALIZED = "{\"short\":40000,\"unsigned\":-1}";
+  this->create_iarchive(SERIALIZED);
+
+  short short_value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("short", short_value)),
+    boost::archive::json_archive_exception
+  );
+
+  unsigned unsigned_value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("unsigned", unsigned_value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeString)
+{
+  static const char* SERIALIZED = "{\"string\":\"hello\"}";
+  this->create_iarchive(SERIALIZED);
+
+  std::string value;
+  ((*ar) & boost::serialization::make_nvp("string", value));
+
+  ASSERT_EQ(value, "hello");
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeLongEscapedString)
+{
+  // Escape sequences on both sides of each 16- and 32-character block boundary
+  std::string serialized = "{\"string\":\"";
+  std::string expected;
+  for (int n = 0; n < 100; ++n)
+  {
+    if (n % 16 == 0 or n % 16 == 15)
+    {
+      serialized += (n % 32 == 0) ? "\\\"" : "\\\\";
+      expected += (n % 32 == 0) ? '"' : '\\';
+    }
+    else
+    {
+      serialized += static_cast<char>('a' + n % 26);
+      expected += static_cast<char>('a' + n % 26);
+    }
+  }
+  serialized += "\"}";
+  this->create_iarchive(serialized.c_str());
+
+  std::string value;
+  ((*ar) & boost::serialization::make_nvp("string", value));
+
+  ASSERT_EQ(value, expected);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStruct)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct\":{"
+        "\"_class_id_optional\":0,"
+        "\"_tracking\":false,"
+        "\"_version\":0,"
+        "\"m\":111"
+      "}"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  TestStruct value;
+  ((*ar) & boost::serialization::make_nvp("struct", value));
+
+  ASSERT_EQ(value, TestStruct{});
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeNestedStruct)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+        "\"nested_struct\":{"
+        "\"_class_id_optional\":0,"
+        "\"_tracking\":false,"
+        "\"_version\":0,"
+        "\"first\":{"
+          "\"_class_id_optional\":1,"
+          "\"_tracking\":false,"
+          "\"_version\":0,"
+          "\"m\":111"
+        "},"
+        "\"second\":{"
+          "\"m\":111"
+        "}"
+      "}"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  NestedTestStruct value;
+  ((*ar) & boost::serialization::make_nvp("nested_struct", value));
+
+  ASSERT_EQ(value, NestedTestStruct{});
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeVersion)
+{
+  static const char* SERIALIZED = "{\"struct\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":3,\"m\":111}}";
+  this->create_iarchive(SERIALIZED);
+
+  VersionedTestStruct value;
+  ((*ar) & boost::serialization::make_nvp("struct", value));
+
+  ASSERT_EQ(value.file_version, 3U);
+  ASSERT_EQ(value.m, 111);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializePointer)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"ptr\":{"
+        "\"_class_id_optional\":0,"
+        "\"_tracking\":false,"
+        "\"_version\":0,"
+        "\"tx\":{"
+          "\"_class_id\":1,"
+          "\"_tracking\":true,"
+          "\"_version\":0,"
+          "\"_object_id\":0,"
+          "\"m\":222"
+        "}"
+      "},"
+      "\"alias\":{\"_class_id_reference\":1,\"_object_reference\":0},"
+      "\"null\":{\"tx\":{\"_class_id\":-1}}"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::unique_ptr<PointeeTestStruct> ptr_value;
+  PointeeTestStruct* alias_value = nullptr;
+  std::unique_ptr<PointeeTestStruct> null_value{new PointeeTestStruct};
+  ((*ar) & boost::serialization::make_nvp("ptr", ptr_value));
+  ((*ar) & boost::serialization::make_nvp("alias", alias_value));
+  ((*ar) & boost::serialization::make_nvp("null", null_value));
+
+  ASSERT_NE(ptr_value, nullptr);
+  ASSERT_EQ(ptr_value->m, 222);
+  ASSERT_EQ(alias_value, ptr_value.get());
+  ASSERT_EQ(null_value, nullptr);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeBoolStdVector)
+{
+  static const char* SERIALIZED = "{\"bool_array\":[true,false,true,false]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<bool> value;
+  ((*ar) & boost::serialization::make_nvp("bool_array", value));
+
+  const std::vector<bool> bool_array_value_target{true, false, true, false};
+  ASSERT_EQ(value, bool_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeBoolStdVectorWithWhitespace)
+{
+  static const char* SERIALIZED = "{\"bool_array\":[ true ,\n false,true , false ]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<bool> value;
+  ((*ar) & boost::serialization::make_nvp("bool_array", value));
+
+  const std::vector<bool> bool_array_value_target{true, false, true, false};
+  ASSERT_EQ(value, bool_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnInvalidBool)
+{
+  static const char* SERIALIZED = "{\"bool_array\":[true,fals]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<bool> value;
+  ASSERT_THROW(((*ar) & boost::serialization::make_nvp("bool_array", value)), boost::archive::json_archive_exception);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnTrailingComma)
+{
+  static const char* SERIALIZED = "{\"bool_array\":[true,false,]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<bool> value;
+  ASSERT_THROW(((*ar) & boost::serialization::make_nvp("bool_array", value)), boost::archive::json_archive_exception);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeBoolStdBitset)
+{
+  static const char* SERIALIZED = "{\"bitset\":[true,false,true,false]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::bitset<4> value;
+  ((*ar) & boost::serialization::make_nvp("bitset", value));
+
+  ASSERT_EQ(value.to_string(), "0101");
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnTooManyBits)
+{
+  static const char* SERIALIZED = "{\"bitset\":[true,false,true,false,true]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::bitset<4> value;
+  ASSERT_THROW(((*ar) & boost::serialization::make_nvp("bitset", value)), boost::archive::json_archive_exception);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeIntStdVector)
+{
+  static const char* SERIALIZED = "{\"int_array\":[1,2,3,4]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<int> value;
+  ((*ar) & boost::serialization::make_nvp("int_array", value));
+
+  const std::vector<int> int_array_value_target{1, 2, 3, 4};
+  ASSERT_EQ(value, int_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeFloatStdVector)
+{
+  static const char* SERIALIZED = "{\"float_array\":[1,2,3,4]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<float> value;
+  ((*ar) & boost::serialization::make_nvp("float_array", value));
+
+  const std::vector<float> float_array_value_target{1.0f, 2.0f, 3.0f, 4.0f};
+  ASSERT_EQ(value, float_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeDoubleStdVector)
+{
+  static const char* SERIALIZED = "{\"double_array\":[1,2,3,4]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<double> value;
+  ((*ar) & boost::serialization::make_nvp("double_array", value));
+
+  const std::vector<double> double_array_value_target{1.0, 2.0, 3.0, 4.0};
+  ASSERT_EQ(value, double_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStringStdVector)
+{
+  static const char* SERIALIZED = "{\"string_array\":[\"p\",\"i\",\"c\",\"o\"]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<std::string> value;
+  ((*ar) & boost::serialization::make_nvp("string_array", value));
+
+  const std::vector<std::string> string_array_value_target{"p", "i", "c", "o"};
+  ASSERT_EQ(value, string_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStructStdVector)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct_array\":["
+        "{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111},"
+        "{\"m\":111}"
+      "]"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<TestStruct> value;
+  ((*ar) & boost::serialization::make_nvp("struct_array", value));
+
+  const std::vector<TestStruct> struct_array_value_target{TestStruct{}, TestStruct{}};
+  ASSERT_EQ(value, struct_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeFloatStdVectorBinary)
+{
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\"<f4\",\"shape\":[2],\"data\":\"AADAPwAAAMA=\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<float> value;
+  ((*ar) & boost::serialization::make_nvp("float_array", value));
+
+  const std::vector<float> float_array_value_target{1.5f, -2.0f};
+  ASSERT_EQ(value, float_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeSwappedFloatStdArrayBinary)
+{
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\">f4\",\"shape\":[2],\"data\":\"P8AAAMAAAAA=\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::array<float, 2> value;
+  ((*ar) & boost::serialization::make_nvp("float_array", value));
+
+  const std::array<float, 2> float_array_value_target{1.5f, -2.0f};
+  ASSERT_EQ(value, float_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeShortStdVectorBinary)
+{
+  static const char* SERIALIZED = "{\"short_array\":{\"dtype\":\"<i2\",\"shape\":[3],\"data\":\"AQD+/ywB\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<short> value;
+  ((*ar) & boost::serialization::make_nvp("short_array", value));
+
+  const std::vector<short> short_array_value_target{1, -2, 300};
+  ASSERT_EQ(value, short_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnBinaryDtypeMismatch)
+{
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\"<f8\",\"shape\":[1],\"data\":\"AADAPwAAAMA=\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<float> value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("float_array", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnBinaryShapeMismatch)
+{
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\"<f4\",\"shape\":[3],\"data\":\"AADAPwAAAMA=\"}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<float> value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("float_array", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeBoolStdArray)
+{
+  static const char* SERIALIZED = "{\"bool_array\":[true,false,true,false]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::array<bool, 4> value;
+  ((*ar) & boost::serialization::make_nvp("bool_array", value));
+
+  const std::array<bool, 4> bool_array_value_target{true, false, true, false};
+  ASSERT_EQ(value, bool_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeIntStdArray)
+{
+  static const char* SERIALIZED = "{\"int_array\":[1,2,3,4]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::array<int, 4> value;
+  ((*ar) & boost::serialization::make_nvp("int_array", value));
+
+  const std::array<int, 4> int_array_value_target{1, 2, 3, 4};
+  ASSERT_EQ(value, int_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeFloatStdArray)
+{
+  static const char* SERIALIZED = "{\"float_array\":[1,2,3,4]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::array<float, 4> value;
+  ((*ar) & boost::serialization::make_nvp("float_array", value));
+
+  const std::array<float, 4> float_array_value_target{1.0f, 2.0f, 3.0f, 4.0f};
+  ASSERT_EQ(value, float_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeDoubleStdArray)
+{
+  static const char* SERIALIZED = "{\"double_array\":[1,2,3,4]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::array<double, 4> value;
+  ((*ar) & boost::serialization::make_nvp("double_array", value));
+
+  const std::array<double, 4> double_array_value_target{1.0, 2.0, 3.0, 4.0};
+  ASSERT_EQ(value, double_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStringStdArray)
+{
+  static const char* SERIALIZED = "{\"string_array\":[\"p\",\"i\",\"c\",\"o\"]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::array<std::string, 4> value;
+  ((*ar) & boost::serialization::make_nvp("string_array", value));
+
+  const std::array<std::string, 4> string_array_value_target{"p", "i", "c", "o"};
+  ASSERT_EQ(value, string_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStructStdArray)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct_array\":["
+        "{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111},"
+        "{\"m\":111}"
+      "]"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::array<TestStruct, 2> value;
+  ((*ar) & boost::serialization::make_nvp("struct_array", value));
+
+  const std::array<TestStruct, 2> struct_array_value_target{TestStruct{}, TestStruct{}};
+  ASSERT_EQ(value, struct_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStringKeyStdMap)
+{
+  static const char* SERIALIZED = "{\"map\":{\"b\":2,\"a\":1,\"quote\\\"d\":3}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::map<std::string, int> value{{"c", 4}};
+  ((*ar) & boost::serialization::make_nvp("map", value));
+
+  const std::map<std::string, int> map_value_target{{"a", 1}, {"b", 2}, {"quote\"d", 3}};
+  ASSERT_EQ(value, map_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStructStdUnorderedMap)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"map\":{"
+        "\"a\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111},"
+        "\"b\":{\"m\":111}"
+      "}"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::unordered_map<std::string, TestStruct> value;
+  ((*ar) & boost::serialization::make_nvp("map", value));
+
+  const std::unordered_map<std::string, TestStruct> map_value_target{{"a", TestStruct{}}, {"b", TestStruct{}}};
+  ASSERT_EQ(value, map_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeIntKeyStdMap)
+{
+  static const char* SERIALIZED = "{\"map\":[[1,\"one\"],[2,\"two\"]],\"multimap\":[[\"a\",1],[\"a\",2]]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::map<int, std::string> value;
+  std::multimap<std::string, int> multimap_value;
+  ((*ar) & boost::serialization::make_nvp("map", value));
+  ((*ar) & boost::serialization::make_nvp("multimap", multimap_value));
+
+  const std::map<int, std::string> map_value_target{{1, "one"}, {2, "two"}};
+  const std::multimap<std::string, int> multimap_value_target{{"a", 1}, {"a", 2}};
+  ASSERT_EQ(value, map_value_target);
+  ASSERT_EQ(multimap_value, multimap_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnInvalidStdMapPair)
+{
+  static const char* SERIALIZED = "{\"map\":[[1,\"one\",2]]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::map<int, std::string> value;
+  ASSERT_THROW(((*ar) & boost::serialization::make_nvp("map", value)), boost::archive::json_archive_exception);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStdSequences)
+{
+  static const char* SERIALIZED = "{\"set\":[1,2,3],\"deque\":[1.5,2.5],\"list\":[\"a\",\"b\"]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::set<int> set_value{4};
+  std::deque<double> deque_value;
+  std::list<std::string> list_value;
+  ((*ar) & boost::serialization::make_nvp("set", set_value));
+  ((*ar) & boost::serialization::make_nvp("deque", deque_value));
+  ((*ar) & boost::serialization::make_nvp("list", list_value));
+
+  ASSERT_EQ(set_value, (std::set<int>{1, 2, 3}));
+  ASSERT_EQ(deque_value, (std::deque<double>{1.5, 2.5}));
+  ASSERT_EQ(list_value, (std::list<std::string>{"a", "b"}));
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStdOptional)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"empty\":null,"
+      "\"int\":5,"
+      "\"struct_array\":[null,{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111}]"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::optional<int> empty_value{3};
+  std::optional<int> int_value;
+  std::vector<std::optional<TestStruct>> struct_array_value;
+  ((*ar) & boost::serialization::make_nvp("empty", empty_value));
+  ((*ar) & boost::serialization::make_nvp("int", int_value));
+  ((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+
+  ASSERT_FALSE(empty_value.has_value());
+  ASSERT_EQ(int_value, 5);
+  const std::vector<std::optional<TestStruct>> struct_array_value_target{std::nullopt, TestStruct{}};
+  ASSERT_EQ(struct_array_value, struct_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStdVariant)
+{
+  static const char* SERIALIZED = "{\"string\":{\"which\":1,\"value\":\"x\"},\"empty\":{\"which\":0}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::variant<int, std::string> string_value;
+  std::variant<std::monostate, int> empty_value{4};
+  ((*ar) & boost::serialization::make_nvp("string", string_value));
+  ((*ar) & boost::serialization::make_nvp("empty", empty_value));
+
+  ASSERT_EQ(string_value, (std::variant<int, std::string>{std::string{"x"}}));
+  ASSERT_EQ(empty_value.index(), 0UL);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnInvalidVariantIndex)
+{
+  static const char* SERIALIZED = "{\"variant\":{\"which\":2,\"value\":1}}";
+  this->create_iarchive(SERIALIZED);
+
+  std::variant<int, std::string> value;
+  ASSERT_THROW(((*ar) & boost::serialization::make_nvp("variant", value)), boost::archive::json_archive_exception);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeStdForwardList)
+{
+  static const char* SERIALIZED = "{\"list\":[1,2]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::forward_list<int> value{3};
+  ((*ar) & boost::serialization::make_nvp("list", value));
+
+  ASSERT_EQ(value, (std::forward_list<int>{1, 2}));
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeBufferedStdMap)
+{
+  // "map" is read before "first" is found, so it is loaded from a buffered document
+  static const char* SERIALIZED = "{\"map\":{\"a\":[1,2],\"b\":[]},\"first\":1}";
+  this->create_iarchive(SERIALIZED);
+
+  int first = 0;
+  std::map<std::string, std::vector<int>> value;
+  ((*ar) & boost::serialization::make_nvp("first", first));
+  ((*ar) & boost::serialization::make_nvp("map", value));
+
+  const std::map<std::string, std::vector<int>> map_value_target{{"a", {1, 2}}, {"b", {}}};
+  ASSERT_EQ(first, 1);
+  ASSERT_EQ(value, map_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeOutOfOrder)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"skipped\":{\"a\":[1,{\"b\":\"}]\"}],\"c\":null},"
+      "\"second\":{\"m\":2},"
+      "\"first\":{\"m\":1}"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  TestStruct first;
+  TestStruct second;
+  ((*ar) & boost::serialization::make_nvp("first", first));
+  ((*ar) & boost::serialization::make_nvp("second", second));
+
+  ASSERT_EQ(first.m, 1);
+  ASSERT_EQ(second.m, 2);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeOutOfOrderNestedStruct)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"nested_struct\":{"
+        "\"second\":{\"m\":2},"
+        "\"first\":{\"m\":1}"
+      "},"
+      "\"int_array\":[1,2,3,4]"
+    "}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<int> int_array_value;
+  NestedTestStruct nested_value;
+  ((*ar) & boost::serialization::make_nvp("int_array", int_array_value));
+  ((*ar) & boost::serialization::make_nvp("nested_struct", nested_value));
+
+  const std::vector<int> int_array_value_target{1, 2, 3, 4};
+  ASSERT_EQ(int_array_value, int_array_value_target);
+  ASSERT_EQ(nested_value.first.m, 1);
+  ASSERT_EQ(nested_value.second.m, 2);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeEscapedString)
+{
+  static const char* SERIALIZED = "{\"string\":\"\\\"a\\/b\\u00e9\\ud83d\\ude00\\n\"}";
+  this->create_iarchive(SERIALIZED);
+
+  std::string value;
+  ((*ar) & boost::serialization::make_nvp("string", value));
+
+  ASSERT_EQ(value, "\"a/b\xc3\xa9\xf0\x9f\x98\x80\n");
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnSyntaxError)
+{
+  static const char* SERIALIZED = "{\"int_array\":[1,2 3]}";
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<int> value;
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("int_array", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeLargeInput)
+{
+  std::vector<double> double_array_value_target(100000);
+  for (std::size_t i = 0; i < double_array_value_target.size(); ++i)
+  {
+    double_array_value_target[i] = 0.5 * static_cast<double>(i);
+  }
+
+  buffer << "{\"double_array\":[";
+  for (std::size_t i = 0; i < double_array_value_target.size(); ++i)
+  {
+    buffer << (i ? "," : "") << double_array_value_target[i];
+  }
+  buffer << "]}";
+  ar.emplace(buffer);
+
+  std::vector<double> value;
+  ((*ar) & boost::serialization::make_nvp("double_array", value));
+
+  ASSERT_EQ(value, double_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeFromBuffer)
+{
+  static const std::string SERIALIZED = "{\"struct\":{\"m\":7},\"int_array\":[1,2,3,4]}";
+  boost::archive::json_stream_iarchive buffer_ar{SERIALIZED.data(), SERIALIZED.size()};
+
+  TestStruct struct_value;
+  std::vector<int> int_array_value;
+  buffer_ar & boost::serialization::make_nvp("struct", struct_value);
+  buffer_ar & boost::serialization::make_nvp("int_array", int_array_value);
+
+  const std::vector<int> int_array_value_target{1, 2, 3, 4};
+  ASSERT_EQ(struct_value.m, 7);
+  ASSERT_EQ(int_array_value, int_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeRuntimeKeys)
+{
+  static const std::string SERIALIZED = "{\"key__\":2,\"key_\":1,\"key\":0}";
+  boost::archive::json_stream_iarchive buffer_ar{SERIALIZED.data(), SERIALIZED.size()};
+
+  // Names are cached by address, so one buffer reused for several names must still find each of them
+  char name[16];
+  for (int n = 0; n < 3; ++n)
+  {
+    const std::string key = "key" + std::string(n, '_');
+    key.copy(name, key.size());
+    name[key.size()] = '\0';
+    int value = -1;
+    buffer_ar & boost::serialization::make_nvp(name, value);
+    ASSERT_EQ(value, n);
+  }
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeLargeStream)
+{
+  std::vector<std::string> string_array_value_target(50000);
+  buffer << "{\"string_array\":[";
+  for (std::size_t i = 0; i < string_array_value_target.size(); ++i)
+  {
+    string_array_value_target[i] = "element_" + std::to_string(i);
+    buffer << (i ? "," : "") << '"' << string_array_value_target[i] << '"';
+  }
+  buffer << "]}";
+  ar.emplace(buffer);
+
+  std::vector<std::string> value;
+  ((*ar) & boost::serialization::make_nvp("string_array", value));
+
+  ASSERT_EQ(value, string_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeLargeBoolStdVector)
+{
+  // Elements which straddle the chunks in which the stream is read
+  std::vector<bool> bool_array_value_target(50000);
+  buffer << "{\"bool_array\":[";
+  for (std::size_t i = 0; i < bool_array_value_target.size(); ++i)
+  {
+    bool_array_value_target[i] = (i % 3) == 0;
+    buffer << (i ? "," : "") << (bool_array_value_target[i] ? "true" : "false");
+  }
+  buffer << "]}";
+  ar.emplace(buffer);
+
+  std::vector<bool> value;
+  ((*ar) & boost::serialization::make_nvp("bool_array", value));
+
+  ASSERT_EQ(value, bool_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeCompactMetadataWithoutBuffering)
+{
+  ArrayTestStruct saved;
+  saved.values.assign(10000, 0.5);
+  saved.m = 7;
+  {
+    boost::archive::json_stream_oarchive oar{buffer, false, boost::archive::json_compact_metadata};
+    oar << boost::serialization::make_nvp("record", saved);
+  }
+  ASSERT_EQ(buffer.str().find("_version"), std::string::npos);
+
+  // Metadata left out of the output is not looked for past the next member, so no member is read out of order
+  CountingResource counting;
+  std::pmr::memory_resource* const previous = std::pmr::set_default_resource(&counting);
+  ArrayTestStruct loaded;
+  try
+  {
+    boost::archive::json_stream_iarchive iar{buffer};
+    iar >> boost::serialization::make_nvp("record", loaded);
+  }
+  catch (...)
+  {
+    std::pmr::set_default_resource(previous);
+    throw;
+  }
+  std::pmr::set_default_resource(previous);
+
+  ASSERT_EQ(counting.n_allocations, 0UL);
+  ASSERT_EQ(loaded.values, saved.values);
+  ASSERT_EQ(loaded.m, 7);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeKeyOnChunkBoundary)
+{
+  // Member names which end at, or just before, the end of the first 64 KiB chunk of the stream, followed by enough
+  // input that the next chunk overwrites the whole read buffer
+  static constexpr std::size_t chunk_size = 1 << 16;
+  const std::string trailing_padding(chunk_size, 'y');
+  for (std::size_t shift = 0; shift < 8; ++shift)
+  {
+    // "{\"pad\":\"" + padding + "\",\"x\"" puts the closing quote of "x" at (padding.size() + 12)
+    const std::string padding(chunk_size - 13 - shift, 'p');
+    std::stringstream stream;
+    stream << "{\"pad\":\"" << padding << "\",\"x\":1,\"map\":{\"k\":2},\"tail\":\"" << trailing_padding << "\"}";
+    boost::archive::json_stream_iarchive stream_ar{stream};
+
+    int x = 0;
+    stream_ar& boost::serialization::make_nvp("x", x);
+    ASSERT_EQ(x, 1) << "shift " << shift;
+  }
+
+  // Same for map keys, which are loaded as they are read
+  for (std::size_t shift = 0; shift < 8; ++shift)
+  {
+    // "{\"map\":{\"" + padding + "\":0,\"k\"" puts the closing quote of "k" at (padding.size() + 15)
+    const std::string padding(chunk_size - 16 - shift, 'p');
+    std::stringstream stream;
+    stream << "{\"map\":{\"" << padding << "\":0,\"k\":2},\"tail\":\"" << trailing_padding << "\"}";
+    boost::archive::json_stream_iarchive stream_ar{stream};
+
+    std::map<std::string, int> value;
+    stream_ar& boost::serialization::make_nvp("map", value);
+    const std::map<std::string, int> map_value_target{{padding, 0}, {"k", 2}};
+    ASSERT_EQ(value, map_value_target) << "shift " << shift;
+  }
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeFromFile)
+{
+  const std::string path = ::testing::TempDir() + "json_stream_iarchive_DeserializeFromFile.json";
+  {
+    std::ofstream ofs{path};
+    ofs << "{\"struct\":{\"m\":7},\"string\":\"es\\\"caped\",\"int_array\":[1,2,3,4]}";
+  }
+
+  TestStruct struct_value;
+  std::string string_value;
+  std::vector<int> int_array_value;
+  {
+    boost::archive::json_stream_iarchive file_ar{std::filesystem::path{path}};
+    file_ar & boost::serialization::make_nvp("int_array", int_array_value);
+    file_ar & boost::serialization::make_nvp("string", string_value);
+    file_ar & boost::serialization::make_nvp("struct", struct_value);
+  }
+  std::remove(path.c_str());
+
+  const std::vector<int> int_array_value_target{1, 2, 3, 4};
+  ASSERT_EQ(struct_value.m, 7);
+  ASSERT_EQ(string_value, "es\"caped");
+  ASSERT_EQ(int_array_value, int_array_value_target);
+}
+
+TEST_F(json_stream_iarchive_test_suite, DeserializeThrowOnMissingFile)
+{
+  ASSERT_THROW(
+    boost::archive::json_stream_iarchive{std::filesystem::path{"/nonexistent/file.json"}},
+    boost::archive::json_archive_exception
+  );
+}
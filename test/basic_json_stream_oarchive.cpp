@@ -0,0 +1,731 @@
+
+// C++ Standard Library
+#include <bitset>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Boost
+#include <boost/serialization/unique_ptr.hpp>
+
+// Boost Archive JSON
+#include <boost/archive/json_oarchive.h>
+#include <boost/archive/json_stream_oarchive.h>
+
+class json_stream_oarchive_test_suite : public ::testing::Test
+{
+public:
+  json_stream_oarchive_test_suite() : buffer{}, ar{std::in_place, buffer, false} {}
+
+  struct TestStruct
+  {
+    int m = 111;
+
+    TestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  struct NestedTestStruct
+  {
+    TestStruct first;
+    TestStruct second;
+
+    NestedTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(first);
+      ar& BOOST_SERIALIZATION_NVP(second);
+    }
+  };
+
+  /// Only ever serialized through pointers, which makes Boost track objects of this type
+  struct PointeeTestStruct
+  {
+    int m = 111;
+
+    PointeeTestStruct() = default;
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  void SetUp() override {}
+
+  void TearDown() override {}
+
+  std::ostringstream buffer;
+  std::optional<boost::archive::json_stream_oarchive> ar;
+};
+
+TEST_F(json_stream_oarchive_test_suite, SerializeBool)
+{
+  const bool value = true;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("bool", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"bool\":true}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeFloat)
+{
+  const float value = 123.0f;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("float", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"float\":123}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeDouble)
+{
+  const double value = 123.456;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("double", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"double\":123.456}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeFloatShortest)
+{
+  const float value = 0.1f;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("float", value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"float\":0.1}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeDoubleShortest)
+{
+  const double value = 0.1 + 0.2;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("double", value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"double\":0.30000000000000004}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeInt)
+{
+  const int value = 99;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("int", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"int\":99}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeInt64)
+{
+  const std::int64_t min_value = std::numeric_limits<std::int64_t>::min();
+  const std::int64_t max_value = std::numeric_limits<std::int64_t>::max();
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("min", min_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("max", max_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"min\":-9223372036854775808,\"max\":9223372036854775807}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeUInt64)
+{
+  const std::uint64_t value = std::numeric_limits<std::uint64_t>::max();
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("uint64", value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"uint64\":18446744073709551615}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeString)
+{
+  const std::string value = "hello";
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("string", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"string\":\"hello\"}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStruct)
+{
+  const TestStruct value;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("struct", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct\":{"
+        "\"_class_id_optional\":0,"
+        "\"_tracking\":false,"
+        "\"_version\":0,"
+        "\"m\":111"
+      "}"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeNestedStruct)
+{
+  const NestedTestStruct value;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("nested_struct", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+        "\"nested_struct\":{"
+        "\"_class_id_optional\":0,"
+        "\"_tracking\":false,"
+        "\"_version\":0,"
+        "\"first\":{"
+          "\"_class_id_optional\":1,"
+          "\"_tracking\":false,"
+          "\"_version\":0,"
+          "\"m\":111"
+        "},"
+        "\"second\":{"
+          "\"m\":111"
+        "}"
+      "}"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializePointer)
+{
+  std::unique_ptr<PointeeTestStruct> ptr_value{new PointeeTestStruct};
+  ptr_value->m = 222;
+  const PointeeTestStruct* alias_value = ptr_value.get();
+  const std::unique_ptr<PointeeTestStruct> null_value;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("ptr", ptr_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("alias", alias_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("null", null_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"ptr\":{"
+        "\"_class_id_optional\":0,"
+        "\"_tracking\":false,"
+        "\"_version\":0,"
+        "\"tx\":{"
+          "\"_class_id\":1,"
+          "\"_tracking\":true,"
+          "\"_version\":0,"
+          "\"_object_id\":0,"
+          "\"m\":222"
+        "}"
+      "},"
+      "\"alias\":{\"_class_id_reference\":1,\"_object_reference\":0},"
+      "\"null\":{\"tx\":{\"_class_id\":-1}}"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeBoolStdVector)
+{
+  std::vector<bool> bool_array_value{true, false, true, false};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("bool_array", bool_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"bool_array\":[true,false,true,false]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeBoolStdBitset)
+{
+  std::bitset<4> bitset_value;
+  bitset_value.set(0);
+  bitset_value.set(2);
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("bitset", bitset_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"bitset\":[true,false,true,false]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeIntStdVector)
+{
+  std::vector<int> int_array_value{1, 2, 3, 4};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("int_array", int_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"int_array\":[1,2,3,4]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeFloatStdVector)
+{
+  std::vector<float> float_array_value{1.0, 2.0, 3.0, 4.0};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("float_array", float_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"float_array\":[1,2,3,4]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeDoubleStdVector)
+{
+  std::vector<double> double_array_value{1.0, 2.0, 3.0, 4.0};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("double_array", double_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"double_array\":[1,2,3,4]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStringStdVector)
+{
+  std::vector<std::string> string_array_value{"p", "i", "c", "o"};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("string_array", string_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"string_array\":[\"p\",\"i\",\"c\",\"o\"]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStructStdVector)
+{
+  std::vector<TestStruct> struct_array_value{TestStruct{}, TestStruct{}};
+  ((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct_array\":["
+        "{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111},"
+        "{\"m\":111}"
+      "]"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeFloatStdVectorBinary)
+{
+  std::ostringstream os;
+  {
+    boost::archive::json_stream_oarchive binary_ar{os, false, boost::archive::json_binary_arrays};
+    const std::vector<float> float_array_value{1.5f, -2.0f};
+    ASSERT_NO_THROW(binary_ar & boost::serialization::make_nvp("float_array", float_array_value));
+  }
+
+  static const char* SERIALIZED = "{\"float_array\":{\"dtype\":\"<f4\",\"shape\":[2],\"data\":\"AADAPwAAAMA=\"}}";
+
+  ASSERT_EQ(os.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeBoolStdArray)
+{
+  std::array<bool, 4> bool_array_value{true, false, true, false};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("bool_array", bool_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"bool_array\":[true,false,true,false]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeIntStdArray)
+{
+  std::array<int, 4> int_array_value{1, 2, 3, 4};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("int_array", int_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"int_array\":[1,2,3,4]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeFloatStdArray)
+{
+  std::array<float, 4> float_array_value{1.0, 2.0, 3.0, 4.0};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("float_array", float_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"float_array\":[1,2,3,4]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeDoubleStdArray)
+{
+  std::array<double, 4> double_array_value{1.0, 2.0, 3.0, 4.0};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("double_array", double_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"double_array\":[1,2,3,4]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStringStdArray)
+{
+  std::array<std::string, 4> string_array_value{"p", "i", "c", "o"};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("string_array", string_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"string_array\":[\"p\",\"i\",\"c\",\"o\"]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStructStdArray)
+{
+  std::array<TestStruct, 2> struct_array_value{TestStruct{}, TestStruct{}};
+  ((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"struct_array\":["
+        "{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111},"
+        "{\"m\":111}"
+      "]"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStringKeyStdMap)
+{
+  std::map<std::string, int> map_value{{"b", 2}, {"a", 1}, {"quote\"d", 3}};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("map", map_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"map\":{\"a\":1,\"b\":2,\"quote\\\"d\":3}}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStructStdUnorderedMap)
+{
+  std::unordered_map<std::string, TestStruct> map_value{{"a", TestStruct{}}};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("map", map_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED =
+    "{\"map\":{\"a\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111}}}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeIntKeyStdMap)
+{
+  std::map<int, std::string> map_value{{2, "two"}, {1, "one"}};
+  std::multimap<std::string, int> multimap_value{{"a", 1}, {"a", 2}};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("map", map_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("multimap", multimap_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"map\":[[1,\"one\"],[2,\"two\"]],\"multimap\":[[\"a\",1],[\"a\",2]]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStdSequences)
+{
+  std::set<int> set_value{3, 1, 2};
+  std::deque<double> deque_value{1.5, 2.5};
+  std::list<std::string> list_value{"a", "b"};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("set", set_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("deque", deque_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("list", list_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"set\":[1,2,3],\"deque\":[1.5,2.5],\"list\":[\"a\",\"b\"]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStdOptional)
+{
+  std::optional<int> empty_value;
+  std::optional<int> int_value{5};
+  std::vector<std::optional<TestStruct>> struct_array_value{std::nullopt, TestStruct{}};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("empty", empty_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("int", int_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{"
+      "\"empty\":null,"
+      "\"int\":5,"
+      "\"struct_array\":[null,{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111}]"
+    "}";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStdVariant)
+{
+  std::variant<int, std::string> string_value{std::string{"x"}};
+  std::variant<std::monostate, int> empty_value;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("string", string_value));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("empty", empty_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"string\":{\"which\":1,\"value\":\"x\"},\"empty\":{\"which\":0}}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeStdForwardList)
+{
+  std::forward_list<int> list_value{1, 2};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("list", list_value));
+
+  // Call destructor to flush to output stream
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"list\":[1,2]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeEmpty)
+{
+  // Call destructor to close root object
+  ar.reset();
+
+  ASSERT_EQ(buffer.str(), "{}");
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeEmptyStdVector)
+{
+  std::vector<TestStruct> struct_array_value;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("struct_array", struct_array_value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"struct_array\":[]}";
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeEscapedString)
+{
+  const std::string value = "\"a/b\\c\"\n\t\x01";
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("string", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"string\":\"\\\"a\\/b\\\\c\\\"\\n\\t\\u0001\"}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeLongEscapedString)
+{
+  // Characters to escape on both sides of each 16- and 32-character block boundary
+  std::string value;
+  std::string escaped;
+  for (int n = 0; n < 100; ++n)
+  {
+    if (n % 16 == 0 or n % 16 == 15)
+    {
+      value += (n % 32 == 0) ? '"' : '\x1f';
+      escaped += (n % 32 == 0) ? "\\\"" : "\\u001f";
+    }
+    else
+    {
+      value += static_cast<char>('a' + n % 26);
+      escaped += static_cast<char>('a' + n % 26);
+    }
+  }
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("string", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  ASSERT_EQ(buffer.str(), "{\"string\":\"" + escaped + "\"}");
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeEscapedKey)
+{
+  const int value = 1;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("a\"b", value));
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"a\\\"b\":1}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeRuntimeKeys)
+{
+  // Names are cached by address, so one buffer reused for several names must still write each of them
+  char name[16];
+  for (int n = 0; n < 3; ++n)
+  {
+    const std::string key = "key" + std::string(n, '_');
+    key.copy(name, key.size());
+    name[key.size()] = '\0';
+    ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp(name, n));
+  }
+
+  // Call destructor to close root object
+  ar.reset();
+
+  static const char* SERIALIZED = "{\"key\":0,\"key_\":1,\"key__\":2}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeWritesBeforeDestruction)
+{
+  const TestStruct value;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("struct", value));
+
+  static const char* SERIALIZED = "{\"struct\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":111}";
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeThrowOnNonFinite)
+{
+  const double value = std::numeric_limits<double>::infinity();
+  ASSERT_THROW(
+    ((*ar) & boost::serialization::make_nvp("double", value)),
+    boost::archive::json_archive_exception
+  );
+}
+
+TEST_F(json_stream_oarchive_test_suite, SerializeMatchesDocumentArchive)
+{
+  const NestedTestStruct nested_value;
+  const std::vector<std::vector<double>> nested_array_value{{1.5, 2.25}, {}, {-3.0}};
+  const std::string string_value = "document";
+  const std::map<std::string, std::optional<int>> map_value{{"a", 1}, {"b", std::nullopt}};
+  const std::map<int, std::vector<int>> pair_map_value{{1, {2, 3}}, {4, {}}};
+
+  for (const bool prettify : {false, true})
+  {
+    std::ostringstream stream_buffer;
+    std::ostringstream document_buffer;
+    {
+      boost::archive::json_stream_oarchive stream_ar{stream_buffer, prettify};
+      stream_ar & boost::serialization::make_nvp("string", string_value);
+      stream_ar & boost::serialization::make_nvp("nested_struct", nested_value);
+      stream_ar & boost::serialization::make_nvp("nested_array", nested_array_value);
+      stream_ar & boost::serialization::make_nvp("map", map_value);
+      stream_ar & boost::serialization::make_nvp("pair_map", pair_map_value);
+    }
+    {
+      boost::archive::json_oarchive document_ar{document_buffer, prettify};
+      document_ar & boost::serialization::make_nvp("string", string_value);
+      document_ar & boost::serialization::make_nvp("nested_struct", nested_value);
+      document_ar & boost::serialization::make_nvp("nested_array", nested_array_value);
+      document_ar & boost::serialization::make_nvp("map", map_value);
+      document_ar & boost::serialization::make_nvp("pair_map", pair_map_value);
+    }
+    ASSERT_EQ(stream_buffer.str(), document_buffer.str());
+  }
+}
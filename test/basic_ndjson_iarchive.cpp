@@ -0,0 +1,142 @@
+// C++ Standard Library
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Boost Archive JSON
+#include <boost/archive/ndjson_iarchive.h>
+#include <boost/archive/ndjson_oarchive.h>
+
+class ndjson_iarchive_test_suite : public ::testing::Test
+{
+public:
+  ndjson_iarchive_test_suite() : buffer{} {}
+
+  struct TestStruct
+  {
+    int m = 111;
+
+    TestStruct() = default;
+
+    explicit TestStruct(const int _m) : m{_m} {}
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  void SetUp() override {}
+
+  void TearDown() override {}
+
+  void create_iarchive(const char* serialized)
+  {
+    buffer.str(serialized);
+    ar.emplace(buffer);
+  }
+
+  std::istringstream buffer;
+  std::optional<boost::archive::ndjson_iarchive> ar;
+};
+
+TEST_F(ndjson_iarchive_test_suite, DeserializeRecords)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{\"event\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":1}}\n"
+    "{\"event\":{\"m\":2}}\n"
+    "{\"event\":{\"m\":3}}\n";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  std::vector<int> values;
+  while (ar->next_record())
+  {
+    TestStruct value;
+    ((*ar) & boost::serialization::make_nvp("event", value));
+    values.push_back(value.m);
+  }
+
+  const std::vector<int> values_target{1, 2, 3};
+  ASSERT_EQ(values, values_target);
+}
+
+TEST_F(ndjson_iarchive_test_suite, DeserializeSkipsUnloadedValues)
+{
+  // clang-format off
+  static const char* SERIALIZED =
+    "{\"skipped\":[{\"s\":\"}\"}],\"count\":1,\"name\":\"first\"}\n"
+    "{\"name\":\"second\",\"count\":2}\n"
+    "{\"unread\":{}}\n"
+    "\n"
+    "{\"count\":4}";
+  // clang-format on
+  this->create_iarchive(SERIALIZED);
+
+  int count = 0;
+  std::string name;
+  ASSERT_TRUE(ar->next_record());
+  ((*ar) & boost::serialization::make_nvp("count", count));
+  ASSERT_EQ(count, 1);
+
+  ASSERT_TRUE(ar->next_record());
+  ((*ar) & boost::serialization::make_nvp("count", count));
+  ((*ar) & boost::serialization::make_nvp("name", name));
+  ASSERT_EQ(count, 2);
+  ASSERT_EQ(name, "second");
+
+  ASSERT_TRUE(ar->next_record());
+  ASSERT_TRUE(ar->next_record());
+  ((*ar) & boost::serialization::make_nvp("count", count));
+  ASSERT_EQ(count, 4);
+
+  ASSERT_FALSE(ar->next_record());
+}
+
+TEST_F(ndjson_iarchive_test_suite, DeserializeEmpty)
+{
+  this->create_iarchive("");
+  ASSERT_FALSE(ar->next_record());
+}
+
+TEST_F(ndjson_iarchive_test_suite, DeserializeThrowOnSyntaxError)
+{
+  this->create_iarchive("{\"count\":1}\n{\"count\":2,}\n");
+
+  int count = 0;
+  ASSERT_TRUE(ar->next_record());
+  ASSERT_TRUE(ar->next_record());
+  ((*ar) & boost::serialization::make_nvp("count", count));
+  ASSERT_EQ(count, 2);
+
+  // Rest of the record is only read once it is skipped
+  ASSERT_THROW(ar->next_record(), boost::archive::json_archive_exception);
+}
+
+TEST_F(ndjson_iarchive_test_suite, DeserializeRoundTrip)
+{
+  std::stringstream stream;
+  {
+    boost::archive::ndjson_oarchive oar{stream};
+    for (int m = 0; m < 100; ++m)
+    {
+      const TestStruct value{m};
+      oar << boost::serialization::make_nvp("event", value);
+    }
+  }
+
+  boost::archive::ndjson_iarchive iar{stream};
+  int expected = 0;
+  while (iar.next_record())
+  {
+    TestStruct value;
+    iar >> boost::serialization::make_nvp("event", value);
+    ASSERT_EQ(value.m, expected++);
+  }
+  ASSERT_EQ(expected, 100);
+}
@@ -0,0 +1,107 @@
+// C++ Standard Library
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Boost Archive JSON
+#include <boost/archive/ndjson_oarchive.h>
+
+class ndjson_oarchive_test_suite : public ::testing::Test
+{
+public:
+  ndjson_oarchive_test_suite() : buffer{}, ar{std::in_place, buffer} {}
+
+  struct TestStruct
+  {
+    int m = 111;
+
+    TestStruct() = default;
+
+    explicit TestStruct(const int _m) : m{_m} {}
+
+    template <typename ArchiveT> inline void serialize(ArchiveT& ar, const unsigned int file_version)
+    {
+      ar& BOOST_SERIALIZATION_NVP(m);
+    }
+  };
+
+  void SetUp() override {}
+
+  void TearDown() override {}
+
+  std::ostringstream buffer;
+  std::optional<boost::archive::ndjson_oarchive> ar;
+};
+
+TEST_F(ndjson_oarchive_test_suite, SerializeRecordPerValue)
+{
+  const TestStruct first{1};
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("event", first));
+
+  // Each record is written as soon as it is saved
+  ASSERT_EQ(buffer.str(), "{\"event\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":1}}\n");
+
+  const TestStruct second{2};
+  const int count = 3;
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("event", second));
+  ASSERT_NO_THROW((*ar) & boost::serialization::make_nvp("count", count));
+  ar.reset();
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{\"event\":{\"_class_id_optional\":0,\"_tracking\":false,\"_version\":0,\"m\":1}}\n"
+    "{\"event\":{\"m\":2}}\n"
+    "{\"count\":3}\n";
+  // clang-format on
+
+  ASSERT_EQ(buffer.str(), SERIALIZED);
+}
+
+TEST_F(ndjson_oarchive_test_suite, SerializeFlushRecord)
+{
+  std::ostringstream grouped_buffer;
+  {
+    boost::archive::ndjson_oarchive grouped_ar{grouped_buffer, false};
+    const std::vector<int> values{1, 2};
+    const std::string name{"line\nbreak"};
+    grouped_ar & boost::serialization::make_nvp("values", values);
+    grouped_ar & boost::serialization::make_nvp("name", name);
+    ASSERT_EQ(grouped_buffer.str(), "");
+
+    grouped_ar.flush_record();
+    ASSERT_EQ(grouped_buffer.str(), "{\"values\":[1,2],\"name\":\"line\\nbreak\"}\n");
+
+    // Records with no values are not written
+    grouped_ar.flush_record();
+    grouped_ar & boost::serialization::make_nvp("name", name);
+  }
+
+  // clang-format off
+  static const char* SERIALIZED =
+    "{\"values\":[1,2],\"name\":\"line\\nbreak\"}\n"
+    "{\"name\":\"line\\nbreak\"}\n";
+  // clang-format on
+
+  ASSERT_EQ(grouped_buffer.str(), SERIALIZED);
+}
+
+TEST_F(ndjson_oarchive_test_suite, SerializeNoRecords)
+{
+  ar.reset();
+  ASSERT_EQ(buffer.str(), "");
+}
+
+TEST_F(ndjson_oarchive_test_suite, SerializeThrowClosesRecord)
+{
+  const double value = std::numeric_limits<double>::quiet_NaN();
+  ASSERT_THROW(((*ar) & boost::serialization::make_nvp("value", value)), boost::archive::json_archive_exception);
+
+  // Destroying the archive mid-record must not throw, and leaves the record closed
+  ASSERT_NO_THROW(ar.reset());
+  ASSERT_EQ(buffer.str(), "{\"value\":null}\n");
+}